@@ -3,6 +3,7 @@
 #include <vector>
 #include <string_view>
 #include <string>
+#include <cstring>
 #include <locale>
 #include <fstream>
 #include <functional>
@@ -11,6 +12,10 @@
 #include <optional>
 #include <sstream>
 #include <cassert>
+#include <algorithm>
+#include <limits>
+
+#include "parser_key_hash.hpp"
 
 // Objects
 struct value_and_optional {
@@ -436,8 +441,31 @@ int32_t max_length(V const& vector) {
 	return mx;
 }
 
+using parsers::case_folded_key_hash;
+using parsers::perfect_hash_slot;
+
+// Groups with at least this many keys are dispatched through a perfect hash instead of the match tree
+constexpr size_t default_perfect_hash_threshold = 32;
+
+template<typename V>
+std::vector<uint32_t> find_perfect_hash_displacements(V const& vector) {
+	std::vector<uint32_t> key_hashes;
+	key_hashes.reserve(vector.size());
+	for(auto const& v : vector)
+		key_hashes.push_back(case_folded_key_hash(v.key));
+	return parsers::find_perfect_hash_displacements(key_hashes);
+}
+
 struct cxx_tree_builder {
 	std::string tabs;
+	size_t perfect_hash_threshold = default_perfect_hash_threshold;
+	std::string namespace_name = "parsers";
+
+// calls to the generated group parsers are qualified, so that a copy emitted into another namespace does not also find the
+// original parsers through argument dependent lookup
+std::string qualified_parse(std::string const& type) const {
+	return namespace_name + "::parse_" + type;
+}
 
 void tabulate_increment() {
 	tabs.push_back('\t');
@@ -543,7 +571,61 @@ std::string construct_match_tree_internal(V const& vector, F const& generator_ma
 	return output;
 }
 
+// Hashes the key, looks up the displacement of its bucket and switches over the resulting slot, so a large group costs a hash
+// of at most three loads and a single verifying comparison instead of a descent through the match tree.
+std::string construct_perfect_hash_dispatch(auto const& vector, std::vector<uint32_t> const& displacements, auto const& generator_match, std::string_view const no_match) {
+	uint32_t const table_size = uint32_t(vector.size());
+	uint32_t const bucket_count = uint32_t(displacements.size());
+	uint32_t const max_d = *std::max_element(displacements.begin(), displacements.end());
+
+	std::string output = tabulate("static constexpr " + std::string(max_d <= 0xFFFF ? "uint16_t" : "uint32_t") + " key_displacement[" + std::to_string(bucket_count) + "] = {");
+	for(uint32_t i = 0; i < bucket_count; ++i) {
+		if(i % 16 == 0)
+			output += "\n" + tabulate("\t");
+		output += std::to_string(displacements[i]) + ",";
+	}
+	output += "\n" + tabulate("};\n");
+	output += tabulate("auto const key_hash = case_folded_key_hash(cur.content);\n");
+	output += tabulate("switch(perfect_hash_slot(key_hash, key_displacement[key_hash % " + std::to_string(bucket_count) + "], " + std::to_string(table_size) + ")) {\n");
+
+	std::vector<decltype(&vector[0])> by_slot(table_size, nullptr);
+	for(auto const& v : vector) {
+		auto const hash = case_folded_key_hash(v.key);
+		by_slot[perfect_hash_slot(hash, displacements[hash % bucket_count], table_size)] = &v;
+	}
+	for(uint32_t slot = 0; slot < table_size; ++slot) {
+		auto const& v = *by_slot[slot];
+		output += tabulate("case " + std::to_string(slot) + ":\n");
+		tabulate_increment();
+		output += tabulate("// " + v.key + "\n");
+		output += tabulate("if(cur.content.length() == " + std::to_string(v.key.length()) + " && " + final_match_condition(v.key, 0, 0) + ") {\n");
+		tabulate_increment();
+		output += tabulate(generator_match(v) + "\n");
+		tabulate_decrement();
+		output += tabulate("} else {\n");
+		tabulate_increment();
+		output += tabulate(std::string(no_match) + "\n");
+		tabulate_decrement();
+		output += tabulate("}\n");
+		output += tabulate("break;\n");
+		tabulate_decrement();
+	}
+	output += tabulate("default:\n");
+	tabulate_increment();
+	output += tabulate(std::string(no_match) + "\n");
+	output += tabulate("break;\n");
+	tabulate_decrement();
+	output += tabulate("}\n");
+	return output;
+}
+
 std::string construct_match_tree_outer(auto const& vector, auto const& generator_match, std::string_view const no_match) {
+	if(vector.size() >= perfect_hash_threshold) {
+		auto const displacements = find_perfect_hash_displacements(vector);
+		if(!displacements.empty())
+			return construct_perfect_hash_dispatch(vector, displacements, generator_match, no_match);
+	}
+
 	auto const maxlen = max_length(vector);
 	std::string output = tabulate("switch(int32_t(cur.content.length())) {\n");
 	for(int32_t l = 1; l <= maxlen; ++l) {
@@ -592,7 +674,7 @@ void file_write_out(std::fstream& stream, std::vector<group_contents>& groups) {
 	// output += "#pragma warning( disable : 4065 )\n";
 	// output += "#pragma warning( disable : 4189 )\n";
 	output += "\n";
-	output += "namespace parsers {\n";
+	output += "namespace " + namespace_name + " {\n";
 	// fn bodies
 	std::vector<bool> declared_groups(groups.size(), false);
 	for(size_t i = 0; i < groups.size(); i++) {
@@ -643,15 +725,15 @@ void file_write_out(std::fstream& stream, std::vector<group_contents>& groups) {
 				} else if(g.set_handler.handler.value == "member") {
 					set_effect = "cobj." +
 						(g.set_handler.handler.opt.length() > 0 ? g.set_handler.handler.opt : std::string("free_group")) +
-						" = parse_" + g.set_handler.type_or_function + "(gen, err, context);";
+						" = " + qualified_parse(g.set_handler.type_or_function) + "(gen, err, context);";
 				} else if(g.set_handler.handler.value == "member_fn") {
 					set_effect = "cobj." +
 						(g.set_handler.handler.opt.length() > 0 ? g.set_handler.handler.opt : std::string("free_group")) +
-						"(parse_" + g.set_handler.type_or_function + "(gen, err, context), err, cur.line, context);";
+						"(" + qualified_parse(g.set_handler.type_or_function) + "(gen, err, context), err, cur.line, context);";
 				} else if(g.set_handler.handler.value == "function") {
 					set_effect =
 						(g.set_handler.handler.opt.length() > 0 ? g.set_handler.handler.opt : std::string("free_group")) +
-						"(cobj, parse_" + g.set_handler.type_or_function + "(gen, err, context), err, cur.line, context);";
+						"(cobj, " + qualified_parse(g.set_handler.type_or_function) + "(gen, err, context), err, cur.line, context);";
 				} else {
 					set_effect = "err.unhandled_free_group(cur); gen.discard_group();";
 				}
@@ -702,15 +784,15 @@ void file_write_out(std::fstream& stream, std::vector<group_contents>& groups) {
 				} else if(g.any_group_handler.handler.value == "member") {
 					no_match_effect = "cobj." +
 						(g.any_group_handler.handler.opt.length() > 0 ? g.any_group_handler.handler.opt : std::string("any_group")) +
-						" = parse_" + g.any_group_handler.type_or_function + "(gen, err, context);";
+						" = " + qualified_parse(g.any_group_handler.type_or_function) + "(gen, err, context);";
 				} else if(g.any_group_handler.handler.value == "member_fn") {
 					no_match_effect = "cobj." +
 						(g.any_group_handler.handler.opt.length() > 0 ? g.any_group_handler.handler.opt : std::string("any_group")) +
-						"(cur.content, parse_" + g.any_group_handler.type_or_function + "(gen, err, context), err, cur.line, context);";
+						"(cur.content, " + qualified_parse(g.any_group_handler.type_or_function) + "(gen, err, context), err, cur.line, context);";
 				} else if(g.any_group_handler.handler.value == "function") {
 					no_match_effect =
 						(g.any_group_handler.handler.opt.length() > 0 ? g.any_group_handler.handler.opt : std::string("any_group")) +
-						"(cobj, cur.content, parse_" + g.any_group_handler.type_or_function + "(gen, err, context), err, cur.line, context);";
+						"(cobj, cur.content, " + qualified_parse(g.any_group_handler.type_or_function) + "(gen, err, context), err, cur.line, context);";
 				} else {
 					no_match_effect = "err.unhandled_group_key(cur); gen.discard_group();";
 				}
@@ -743,7 +825,7 @@ void file_write_out(std::fstream& stream, std::vector<group_contents>& groups) {
 				handler_type = handler.value
 				handler_opt = handler.opt
 			*/
-			auto match_handler = [](group_association const& v) {
+			auto match_handler = [this](group_association const& v) {
 				std::string out;
 				if(v.is_extern) {
 					if(v.handler.value == "discard") {
@@ -765,13 +847,13 @@ void file_write_out(std::fstream& stream, std::vector<group_contents>& groups) {
 						out = "gen.discard_group();";
 					} else if(v.handler.value == "member") {
 						out = "cobj." + (v.handler.opt.length() > 0 ? v.handler.opt : v.key) +
-							" = parse_" + v.type_or_function + "(gen, err, context);";
+							" = " + qualified_parse(v.type_or_function) + "(gen, err, context);";
 					} else if(v.handler.value == "member_fn") {
 						out = "cobj." + (v.handler.opt.length() > 0 ? v.handler.opt : v.key) +
-							"(parse_" + v.type_or_function + "(gen, err, context), err, cur.line, context);";
+							"(" + qualified_parse(v.type_or_function) + "(gen, err, context), err, cur.line, context);";
 					} else if(v.handler.value == "function") {
 						out = (v.handler.opt.length() > 0 ? v.handler.opt : v.key) +
-							"(cobj, parse_" + v.type_or_function + "(gen, err, context), err, cur.line, context);";
+							"(cobj, " + qualified_parse(v.type_or_function) + "(gen, err, context), err, cur.line, context);";
 					} else {
 						out = "err.unhandled_group_key(cur);";
 					}
@@ -886,13 +968,28 @@ void file_write_out(std::fstream& stream, std::vector<group_contents>& groups) {
 };
 
 int main(int argc, char *argv[]) {
-	if(argc > 1) {
-		auto const input_filename = std::string(argv[1]);
+	// options: --match-tree-only emits the match tree for every group, --namespace <name> emits into another namespace,
+	// which lets a second copy of the same parsers be compiled alongside the first
+	cxx_tree_builder tree_builder{};
+	std::vector<std::string> positional;
+	for(int i = 1; i < argc; ++i) {
+		auto const arg = std::string_view(argv[i]);
+		if(arg == "--match-tree-only") {
+			tree_builder.perfect_hash_threshold = std::numeric_limits<size_t>::max();
+		} else if(arg == "--namespace" && i + 1 < argc) {
+			tree_builder.namespace_name = argv[++i];
+		} else {
+			positional.emplace_back(arg);
+		}
+	}
+
+	if(!positional.empty()) {
+		auto const input_filename = positional[0];
 		std::string output_filename;
-		if(argc > 2) {
-			output_filename = std::string(argv[2]);
+		if(positional.size() > 1) {
+			output_filename = positional[1];
 		} else {
-			output_filename = std::string(argv[1]);
+			output_filename = positional[0];
 			if(output_filename.length() >= 4 && output_filename[output_filename.length() - 4] == '.') {
 				output_filename.pop_back();
 				output_filename.pop_back();
@@ -917,10 +1014,9 @@ int main(int argc, char *argv[]) {
 		if(state.error_count > 0)
 			std::exit(EXIT_FAILURE);
 		
-		cxx_tree_builder tree_builder{};
 		tree_builder.file_write_out(output_file, state.groups);
 	} else {
-		fprintf(stderr, "Usage: %s <input> [output]\n", argv[0]);
+		fprintf(stderr, "Usage: %s <input> [output] [--match-tree-only] [--namespace <name>]\n", argv[0]);
 	}
 	return 0;
 }
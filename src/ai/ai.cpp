@@ -806,27 +806,47 @@ void get_desired_factory_types(sys::state& state, dcon::nation_id nid, std::vect
 	}
 }
 
+struct econ_construction_plan {
+	dcon::state_instance_id state; // set for factory projects
+	dcon::factory_type_id factory_type;
+	bool is_upgrade = false;
+	dcon::province_id province; // set for province building projects
+	economy::province_building_type building_type = economy::province_building_type::railroad;
+};
+
 void update_ai_econ_construction(sys::state& state) {
-	for(auto n : state.world.in_nation) {
+	// plan in parallel: a nation only ever builds in the states and provinces it owns, so no nation's choices depend on
+	// another's; projects are then created serially, in nation order, so they get the same ids as a serial pass would give them
+	std::vector<std::vector<econ_construction_plan>> plans(state.world.nation_size());
+	concurrency::parallel_for(uint32_t(0), state.world.nation_size(), [&](uint32_t index) {
+		auto n = fatten(state.world, dcon::nation_id{ dcon::nation_id::value_base_t(index) });
 		// skip over: non ais, dead nations, and nations that aren't making money
 		if(n.get_is_player_controlled() || n.get_owned_province_count() == 0 || !n.get_is_civilized())
-			continue;
+			return;
 		if(n.get_spending_level() < 1.0f || n.get_last_treasury() >= n.get_stockpiles(economy::money))
-			continue;
+			return;
 
+		auto& plan = plans[index];
 		auto treasury = n.get_stockpiles(economy::money);
 		int32_t max_projects = std::max(8, int32_t(treasury / 8000.0f));
 		auto rules = n.get_combined_issue_rules();
 
+		// projects planned earlier in this pass are not in the world yet
+		auto planned_in_state = [&](dcon::state_instance_id si, dcon::factory_type_id type) {
+			for(auto& p : plan) {
+				if(p.state == si && p.factory_type == type)
+					return true;
+			}
+			return false;
+		};
+
 		if((rules & issue_rule::expand_factory) != 0 || (rules & issue_rule::build_factory) != 0) {
-			static::std::vector<dcon::factory_type_id> desired_types;
-			desired_types.clear();
+			std::vector<dcon::factory_type_id> desired_types;
 			get_desired_factory_types(state, n, desired_types);
 
 			// desired types filled: try to construct or upgrade
 			if(!desired_types.empty()) {
-				static std::vector<dcon::state_instance_id> ordered_states;
-				ordered_states.clear();
+				std::vector<dcon::state_instance_id> ordered_states;
 				for(auto si : n.get_state_ownership()) {
 					if(si.get_state().get_capital().get_is_colonial() == false)
 						ordered_states.push_back(si.get_state().id);
@@ -859,7 +879,7 @@ void update_ai_econ_construction(sys::state& state) {
 									&& fac.get_factory().get_level() < uint8_t(255) && fac.get_factory().get_primary_employment() >= 0.9f
 									&& std::find(desired_types.begin(), desired_types.end(), type) != desired_types.end()) {
 
-									auto ug_in_progress = false;
+									auto ug_in_progress = planned_in_state(si, type);
 									for(auto c : state.world.state_instance_get_state_building_construction(si)) {
 										if(c.get_type() == type) {
 											ug_in_progress = true;
@@ -867,11 +887,7 @@ void update_ai_econ_construction(sys::state& state) {
 										}
 									}
 									if(!ug_in_progress) {
-										auto new_up = fatten(state.world, state.world.force_create_state_building_construction(si, n));
-										new_up.set_is_pop_project(false);
-										new_up.set_is_upgrade(true);
-										new_up.set_type(type);
-
+										plan.push_back(econ_construction_plan{ si, type, true });
 										--max_projects;
 										return;
 									}
@@ -908,57 +924,50 @@ void update_ai_econ_construction(sys::state& state) {
 								if(p.get_type() == type_selection)
 									return true;
 							}
-							return false;
-							}();
-							if(already_in_progress)
-								continue;
+							return planned_in_state(si, type_selection);
+						}();
+						if(already_in_progress)
+							continue;
 
-							if((rules & issue_rule::expand_factory) != 0) { // check: if present, try to upgrade
-								bool present_in_location = false;
-								bool under_cap = false;
-								province::for_each_province_in_state_instance(state, si, [&](dcon::province_id p) {
-									for(auto fac : state.world.province_get_factory_location(p)) {
-										auto type = fac.get_factory().get_building_type();
-										if(type_selection == type) {
-											under_cap = fac.get_factory().get_production_scale() < 0.9f
-												&& fac.get_factory().get_primary_employment() >= 0.9f;
-											present_in_location = true;
-											return;
-										}
+						if((rules & issue_rule::expand_factory) != 0) { // check: if present, try to upgrade
+							bool present_in_location = false;
+							bool under_cap = false;
+							province::for_each_province_in_state_instance(state, si, [&](dcon::province_id p) {
+								for(auto fac : state.world.province_get_factory_location(p)) {
+									auto type = fac.get_factory().get_building_type();
+									if(type_selection == type) {
+										under_cap = fac.get_factory().get_production_scale() < 0.9f
+											&& fac.get_factory().get_primary_employment() >= 0.9f;
+										present_in_location = true;
+										return;
 									}
-								});
-								if(under_cap) {
-									continue; // factory doesn't need to get larger
-								}
-								if(present_in_location) {
-									auto new_up = fatten(state.world, state.world.force_create_state_building_construction(si, n));
-									new_up.set_is_pop_project(false);
-									new_up.set_is_upgrade(true);
-									new_up.set_type(type_selection);
-									--max_projects;
-									continue;
 								}
+							});
+							if(under_cap) {
+								continue; // factory doesn't need to get larger
 							}
-
-							// else -- try to build -- must have room
-							int32_t num_factories = economy::state_factory_count(state, si, n);
-							if(num_factories < int32_t(state.defines.factories_per_state)) {
-								auto new_up = fatten(state.world, state.world.force_create_state_building_construction(si, n));
-								new_up.set_is_pop_project(false);
-								new_up.set_is_upgrade(false);
-								new_up.set_type(type_selection);
+							if(present_in_location) {
+								plan.push_back(econ_construction_plan{ si, type_selection, true });
 								--max_projects;
 								continue;
-							} else {
-								// TODO: try to delete a factory here
 							}
+						}
+
+						// else -- try to build -- must have room
+						int32_t num_factories = economy::state_factory_count(state, si, n);
+						if(num_factories < int32_t(state.defines.factories_per_state)) {
+							plan.push_back(econ_construction_plan{ si, type_selection, false });
+							--max_projects;
+							continue;
+						} else {
+							// TODO: try to delete a factory here
+						}
 					} // END for(auto si : ordered_states) {
-				} // END if((rules & issue_rule::build_factory) == 0) 
+				} // END if((rules & issue_rule::build_factory) == 0)
 			} // END if(!desired_types.empty()) {
 		} // END  if((rules & issue_rule::expand_factory) != 0 || (rules & issue_rule::build_factory) != 0)
 
-		static std::vector<dcon::province_id> project_provs;
-		project_provs.clear();
+		std::vector<dcon::province_id> project_provs;
 
 		// try naval bases
 		if(max_projects > 0) {
@@ -994,12 +1003,10 @@ void update_ai_econ_construction(sys::state& state) {
 					return a.index() < b.index();
 			});
 			if(!project_provs.empty()) {
-				auto si = state.world.province_get_state_membership(project_provs[0]);
-				if(si)
-					si.set_naval_base_is_taken(true);
-				auto new_rr = fatten(state.world, state.world.force_create_province_building_construction(project_provs[0], n));
-				new_rr.set_is_pop_project(false);
-				new_rr.set_type(uint8_t(economy::province_building_type::naval_base));
+				econ_construction_plan p;
+				p.province = project_provs[0];
+				p.building_type = economy::province_building_type::naval_base;
+				plan.push_back(p);
 				--max_projects;
 			}
 		}
@@ -1041,9 +1048,10 @@ void update_ai_econ_construction(sys::state& state) {
 						return a.index() < b.index();
 				});
 				for(uint32_t j = 0; j < project_provs.size() && max_projects > 0; ++j) {
-					auto new_proj = fatten(state.world, state.world.force_create_province_building_construction(project_provs[j], n));
-					new_proj.set_is_pop_project(false);
-					new_proj.set_type(uint8_t(econ_buildable[i].type));
+					econ_construction_plan p;
+					p.province = project_provs[j];
+					p.building_type = econ_buildable[i].type;
+					plan.push_back(p);
 					--max_projects;
 				}
 			}
@@ -1081,13 +1089,35 @@ void update_ai_econ_construction(sys::state& state) {
 					return a.index() < b.index();
 			});
 
-			for(uint32_t i = 0; i < project_provs.size() && max_projects > 0; ++i) {
-				auto new_rr = fatten(state.world, state.world.force_create_province_building_construction(project_provs[i], n));
-				new_rr.set_is_pop_project(false);
-				new_rr.set_type(uint8_t(economy::province_building_type::fort));
+			for(uint32_t j = 0; j < project_provs.size() && max_projects > 0; ++j) {
+				econ_construction_plan p;
+				p.province = project_provs[j];
+				p.building_type = economy::province_building_type::fort;
+				plan.push_back(p);
 				--max_projects;
 			}
 		}
+	});
+
+	for(uint32_t i = 0; i < uint32_t(plans.size()); ++i) {
+		dcon::nation_id n{ dcon::nation_id::value_base_t(i) };
+		for(auto& p : plans[i]) {
+			if(p.state) {
+				auto new_up = fatten(state.world, state.world.force_create_state_building_construction(p.state, n));
+				new_up.set_is_pop_project(false);
+				new_up.set_is_upgrade(p.is_upgrade);
+				new_up.set_type(p.factory_type);
+			} else {
+				if(p.building_type == economy::province_building_type::naval_base) {
+					auto si = state.world.province_get_state_membership(p.province);
+					if(si)
+						si.set_naval_base_is_taken(true);
+				}
+				auto new_proj = fatten(state.world, state.world.force_create_province_building_construction(p.province, n));
+				new_proj.set_is_pop_project(false);
+				new_proj.set_type(uint8_t(p.building_type));
+			}
+		}
 	}
 }
 
@@ -1209,9 +1239,13 @@ void civilize(sys::state& state) {
 }
 
 void take_reforms(sys::state& state) {
-	for(auto n : state.world.in_nation) {
+	// choose in parallel (each choice only reads the nation's own state), then enact in nation order
+	auto issue_choice = ve::vectorizable_buffer<dcon::issue_option_id, dcon::nation_id>(state.world.nation_size());
+	auto reform_choice = ve::vectorizable_buffer<dcon::reform_option_id, dcon::nation_id>(state.world.nation_size());
+	concurrency::parallel_for(uint32_t(0), state.world.nation_size(), [&](uint32_t i) {
+		auto n = fatten(state.world, dcon::nation_id{ dcon::nation_id::value_base_t(i) });
 		if(n.get_is_player_controlled() || n.get_owned_province_count() == 0)
-			continue;
+			return;
 
 		if(n.get_is_civilized()) { // political & social
 			// Enact social policies to deter Jacobin rebels from overruning the country
@@ -1244,9 +1278,7 @@ void take_reforms(sys::state& state) {
 					}
 				});
 			}
-			if(iss) {
-				nations::enact_issue(state, n, iss);
-			}
+			issue_choice.set(n, iss);
 		} else { // military and economic
 			dcon::reform_option_id cheap_r;
 			float cheap_cost = 0.0f;
@@ -1274,9 +1306,16 @@ void take_reforms(sys::state& state) {
 			}
 
 			if(cheap_r && cheap_cost <= n.get_research_points()) {
-				nations::enact_reform(state, n, cheap_r);
+				reform_choice.set(n, cheap_r);
 			}
 		}
+	});
+	for(auto n : state.world.in_nation) {
+		if(auto iss = issue_choice.get(n); iss) {
+			nations::enact_issue(state, n, iss);
+		} else if(auto r = reform_choice.get(n); r) {
+			nations::enact_reform(state, n, r);
+		}
 	}
 }
 
@@ -1826,41 +1865,50 @@ bool will_accept_crisis_peace_offer(sys::state& state, dcon::nation_id to, dcon:
 }
 
 void update_war_intervention(sys::state& state) {
-	for(auto& gp : state.great_nations) {
-		if(state.world.nation_get_is_player_controlled(gp.nation) == false && state.world.nation_get_is_at_war(gp.nation) == false) {
-			bool as_attacker = false;
-			dcon::war_id intervention_target;
-			[&]() {
-				for(auto w : state.world.in_war) {
-					if(w.get_is_great()) {
-						if(command::can_intervene_in_war(state, gp.nation, w, false)) {
-							for(auto par : w.get_war_participant()) {
-								if(par.get_is_attacker() && military::can_use_cb_against(state, gp.nation, par.get_nation())) {
-									intervention_target = w;
-									return;
-								}
-							}
-						}
-						if(command::can_intervene_in_war(state, gp.nation, w, true)) {
-							for(auto par : w.get_war_participant()) {
-								if(!par.get_is_attacker() && military::can_use_cb_against(state, gp.nation, par.get_nation())) {
-									intervention_target = w;
-									as_attacker = true;
-									return;
-								}
-							}
+	struct intervention_choice {
+		dcon::war_id target;
+		bool as_attacker = false;
+	};
+	// pick targets against the state at the start of the pass, then recheck each one as it is applied since
+	// an earlier intervention can change what a later great power is allowed to join
+	std::vector<intervention_choice> choices(state.great_nations.size());
+	concurrency::parallel_for(uint32_t(0), uint32_t(state.great_nations.size()), [&](uint32_t i) {
+		auto gp = state.great_nations[i].nation;
+		if(state.world.nation_get_is_player_controlled(gp) || state.world.nation_get_is_at_war(gp))
+			return;
+
+		auto& choice = choices[i];
+		for(auto w : state.world.in_war) {
+			if(w.get_is_great()) {
+				if(command::can_intervene_in_war(state, gp, w, false)) {
+					for(auto par : w.get_war_participant()) {
+						if(par.get_is_attacker() && military::can_use_cb_against(state, gp, par.get_nation())) {
+							choice.target = w;
+							return;
 						}
-					} else if(military::get_role(state, w, state.world.nation_get_ai_rival(gp.nation)) == military::war_role::attacker) {
-						if(command::can_intervene_in_war(state, gp.nation, w, false)) {
-							intervention_target = w;
+					}
+				}
+				if(command::can_intervene_in_war(state, gp, w, true)) {
+					for(auto par : w.get_war_participant()) {
+						if(!par.get_is_attacker() && military::can_use_cb_against(state, gp, par.get_nation())) {
+							choice.target = w;
+							choice.as_attacker = true;
 							return;
 						}
 					}
 				}
-				}();
-				if(intervention_target) {
-					command::execute_intervene_in_war(state, gp.nation, intervention_target, as_attacker);
+			} else if(military::get_role(state, w, state.world.nation_get_ai_rival(gp)) == military::war_role::attacker) {
+				if(command::can_intervene_in_war(state, gp, w, false)) {
+					choice.target = w;
+					return;
 				}
+			}
+		}
+	});
+	for(uint32_t i = 0; i < uint32_t(choices.size()); ++i) {
+		auto gp = state.great_nations[i].nation;
+		if(choices[i].target && state.world.nation_get_is_at_war(gp) == false && command::can_intervene_in_war(state, gp, choices[i].target, choices[i].as_attacker)) {
+			command::execute_intervene_in_war(state, gp, choices[i].target, choices[i].as_attacker);
 		}
 	}
 }
@@ -3983,48 +4031,46 @@ bool army_ready_for_battle(sys::state& state, dcon::nation_id n, dcon::army_id a
 }
 
 void gather_to_battle(sys::state& state, dcon::nation_id n, dcon::province_id p) {
-	for(auto ar : state.world.nation_get_army_control(n)) {
-		army_activity activity = army_activity(ar.get_army().get_ai_activity());
-		if(ar.get_army().get_battle_from_army_battle_participation()
-			|| ar.get_army().get_navy_from_army_transport()
-			|| ar.get_army().get_black_flag()
-			|| ar.get_army().get_arrival_time()
-			|| (activity != army_activity::on_guard && activity != army_activity::attacking && activity != army_activity::attack_gathered && activity != army_activity::attack_transport)
-			|| !army_ready_for_battle(state, n, ar.get_army())) {
-
-			continue;
-		}
-
-		auto location = ar.get_army().get_location_from_army_location();
+	province::for_each_province_within(state, p, state.defines.alice_ai_gather_radius, [&](dcon::province_id location) {
 		if(location == p)
-			continue;
+			return;
+		for(auto ar : state.world.province_get_army_location(location)) {
+			if(ar.get_army().get_controller_from_army_control() != n)
+				continue;
+			army_activity activity = army_activity(ar.get_army().get_ai_activity());
+			if(ar.get_army().get_battle_from_army_battle_participation()
+				|| ar.get_army().get_navy_from_army_transport()
+				|| ar.get_army().get_black_flag()
+				|| ar.get_army().get_arrival_time()
+				|| (activity != army_activity::on_guard && activity != army_activity::attacking && activity != army_activity::attack_gathered && activity != army_activity::attack_transport)
+				|| !army_ready_for_battle(state, n, ar.get_army())) {
 
-		auto sdist = province::sorting_distance(state, location, p);
-		if(sdist > state.defines.alice_ai_gather_radius)
-			continue;
+				continue;
+			}
 
-		auto jpath = province::make_land_path(state, location, p, n, ar.get_army());
-		if(!jpath.empty()) {
+			auto jpath = province::make_land_path(state, location, p, n, ar.get_army());
+			if(!jpath.empty()) {
 
-			auto existing_path = ar.get_army().get_path();
-			auto new_size = uint32_t(jpath.size());
-			existing_path.resize(new_size * 2);
+				auto existing_path = ar.get_army().get_path();
+				auto new_size = uint32_t(jpath.size());
+				existing_path.resize(new_size * 2);
 
-			for(uint32_t k = 0; k < new_size; ++k) {
-				assert(jpath[k]);
-				existing_path[new_size + k] = jpath[k];
-			}
-			for(uint32_t k = 1; k < new_size; ++k) {
-				assert(jpath[k]);
-				existing_path[new_size - k] = jpath[k];
+				for(uint32_t k = 0; k < new_size; ++k) {
+					assert(jpath[k]);
+					existing_path[new_size + k] = jpath[k];
+				}
+				for(uint32_t k = 1; k < new_size; ++k) {
+					assert(jpath[k]);
+					existing_path[new_size - k] = jpath[k];
+				}
+				assert(location);
+				existing_path[0] = location;
+				ar.get_army().set_arrival_time(military::arrival_time_to(state, ar.get_army(), jpath.back()));
+				ar.get_army().set_dig_in(0);
 			}
-			assert(location);
-			existing_path[0] = location;
-			ar.get_army().set_arrival_time(military::arrival_time_to(state, ar.get_army(), jpath.back()));
-			ar.get_army().set_dig_in(0);
-		}
 
-	}
+		}
+	});
 }
 
 bool rebel_army_in_province(sys::state& state, dcon::province_id p) {
@@ -4052,19 +4098,17 @@ float conservative_estimate_army_strength(sys::state& state, dcon::army_id a) {
 
 float estimate_attack_force(sys::state& state, dcon::province_id target, dcon::nation_id by) {
 	float strength_total = 0.f;
-	for(auto ar : state.world.in_army) {
-		if(ar.get_is_retreating() || ar.get_battle_from_army_battle_participation())
-			continue;
+	province::for_each_province_within(state, target, state.defines.alice_ai_threat_radius, [&](dcon::province_id loc) {
+		for(auto ar : state.world.province_get_army_location(loc)) {
+			if(ar.get_army().get_is_retreating() || ar.get_army().get_battle_from_army_battle_participation())
+				continue;
 
-		auto loc = ar.get_location_from_army_location();
-		auto sdist = province::sorting_distance(state, loc, target);
-		if(sdist < state.defines.alice_ai_threat_radius) {
-			auto other_nation = ar.get_controller_from_army_control();
+			auto other_nation = ar.get_army().get_controller_from_army_control();
 			if((by != other_nation) && (!other_nation || military::are_at_war(state, other_nation, by))) {
-				strength_total += estimate_army_strength(state, ar);
+				strength_total += estimate_army_strength(state, ar.get_army());
 			}
 		}
-	}
+	});
 	return state.defines.alice_ai_threat_overestimate * strength_total;
 }
 
@@ -4165,8 +4209,8 @@ void assign_targets(sys::state& state, dcon::nation_id n) {
 
 		auto target_attack_force = estimate_attack_force(state, potential_targets[i].location, n);
 		std::sort(ready_armies.begin(), ready_armies.end(), [&](dcon::province_id a, dcon::province_id b) {
-			auto adist = province::direct_distance(state, a, potential_targets[i].location);
-			auto bdist = province::direct_distance(state, b, potential_targets[i].location);
+			auto adist = province::sorting_distance(state, a, potential_targets[i].location);
+			auto bdist = province::sorting_distance(state, b, potential_targets[i].location);
 			if(adist != bdist)
 				return adist > bdist;
 			else
@@ -889,7 +889,8 @@ float effective_technology_cost(sys::state& state, uint32_t current_year, dcon::
 				 (1.0f - std::max(0.0f, float(int32_t(current_year) - availability_year) / state.defines.tech_year_span));
 }
 
-void update_research(sys::state& state, uint32_t current_year) {
+bool update_research(sys::state& state, uint32_t current_year) {
+	bool completed_any = false;
 	for(auto n : state.world.in_nation) {
 		if(n.get_owned_province_count() != 0 && n.get_current_research()) {
 			if(n.get_active_technologies(n.get_current_research())) {
@@ -899,6 +900,7 @@ void update_research(sys::state& state, uint32_t current_year) {
 				if(n.get_research_points() >= cost) {
 					n.get_research_points() -= cost;
 					apply_technology(state, n, n.get_current_research());
+					completed_any = true;
 
 					notification::post(state, notification::message{
 						[t = n.get_current_research()](sys::state& state, text::layout_base& contents) {
@@ -915,6 +917,7 @@ void update_research(sys::state& state, uint32_t current_year) {
 			}
 		}
 	}
+	return completed_any;
 }
 
 void discover_inventions(sys::state& state) {
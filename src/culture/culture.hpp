@@ -183,7 +183,7 @@ void set_default_issue_and_reform_options(sys::state& state);
 void restore_unsaved_values(sys::state& state);
 
 float effective_technology_cost(sys::state& state, uint32_t current_year, dcon::nation_id target_nation, dcon::technology_id tech_id);
-void update_research(sys::state& state, uint32_t current_year);
+bool update_research(sys::state& state, uint32_t current_year); // true if some nation completed a technology
 void discover_inventions(sys::state& state);
 void fix_slaves_in_province(sys::state& state, dcon::nation_id owner, dcon::province_id p);
 
@@ -420,7 +420,7 @@ float pop_vote_weight(sys::state& state, dcon::pop_id p, dcon::nation_id n) {
 	}
 }
 
-void recalculate_upper_house(sys::state& state, dcon::nation_id n) {
+void upper_house_from_votes(sys::state& state, dcon::nation_id n) {
 	/*
 	Every year, the upper house of each nation is updated. If the "same as ruling party" rule is set, the upper house becomes 100%
 	the ideology of the ruling party. If the rule is "state vote", then for each non-colonial state: for each pop in the state
@@ -430,8 +430,8 @@ void recalculate_upper_house(sys::state& state, dcon::nation_id n) {
 	just the rich ones for "rich only") is distributed proportionally to its ideological support, with the sum for all eligible
 	pops forming the distribution for the upper house.
 	*/
-	static std::vector<float> accumulated_in_state;
-	accumulated_in_state.resize(state.world.ideology_size());
+	// not static: this is run for many nations in parallel by update_upper_houses
+	std::vector<float> accumulated_in_state(state.world.ideology_size());
 
 	auto rules = state.world.nation_get_combined_issue_rules(n);
 	auto allowed_ideo = state.world.nation_get_government_type(n).get_ideologies_allowed();
@@ -571,7 +571,9 @@ void recalculate_upper_house(sys::state& state, dcon::nation_id n) {
 				state.world.nation_set_upper_house(n, rp_ideology, 100.0f);
 		}
 	}
+}
 
+void notify_upper_house(sys::state& state, dcon::nation_id n) {
 	if(n == state.local_player_nation) {
 		notification::post(state, notification::message{
 			[](sys::state& state, text::layout_base& contents) {
@@ -590,6 +592,22 @@ void recalculate_upper_house(sys::state& state, dcon::nation_id n) {
 	}
 }
 
+void recalculate_upper_house(sys::state& state, dcon::nation_id n) {
+	upper_house_from_votes(state, n);
+	notify_upper_house(state, n);
+}
+
+void update_upper_houses(sys::state& state) {
+	// each nation's upper house depends only on its own pops, so the nations can be done in parallel
+	concurrency::parallel_for(uint32_t(0), state.world.nation_size(), [&](uint32_t i) {
+		dcon::nation_id n{ dcon::nation_id::value_base_t(i) };
+		if(state.world.nation_is_valid(n) && state.world.nation_get_owned_province_count(n) != 0)
+			upper_house_from_votes(state, n);
+	});
+	if(state.local_player_nation && state.world.nation_get_owned_province_count(state.local_player_nation) != 0)
+		notify_upper_house(state, state.local_player_nation);
+}
+
 void daily_party_loyalty_update(sys::state& state) {
 	province::for_each_land_province(state, [&](dcon::province_id p) {
 		auto si = state.world.province_get_state_membership(p);
@@ -654,130 +672,187 @@ void start_election(sys::state& state, dcon::nation_id n) {
 	}
 }
 
-void update_elections(sys::state& state) {
-	static std::vector<party_vote> party_votes;
-	static std::vector<party_vote> provincial_party_votes;
+/*
+* Per-party data that does not depend on the pop voting, computed once per election rather than once per pop
+*/
+struct party_tally_entry {
+	dcon::political_party_id par;
+	dcon::ideology_id ideology;
+	dcon::pop_demographics_key ideology_key;
+	float vote = 0.0f;
+};
 
-	for(auto n : state.world.in_nation) {
-		/*
-		A country with elections starts one every 5 years.
-		Elections last define:CAMPAIGN_DURATION months.
-		*/
-		if(has_elections(state, n)) {
-			if(n.get_election_ends() == state.current_date) {
-				// make election results
+/*
+* Fills party_votes with the national result of an election in n, and applies the provincial loyalty boosts for the winner in
+* each province. Touches only n and the provinces it owns, so elections in different nations may be tallied in parallel.
+*/
+void tally_election(sys::state& state, dcon::nation_id n, std::vector<party_vote>& party_votes) {
+	party_votes.clear();
+
+	auto tag = state.world.nation_get_identity_from_identity_holder(n);
+	auto start = state.world.national_identity_get_political_party_first(tag).id.index();
+	auto end = start + state.world.national_identity_get_political_party_count(tag);
+	auto allowed_ideo = state.world.government_type_get_ideologies_allowed(state.world.nation_get_government_type(n));
+
+	for(int32_t i = start; i < end; i++) {
+		auto pid = dcon::political_party_id(dcon::political_party_id::value_base_t(i));
+		if(politics::political_party_is_active(state, pid) &&
+				(allowed_ideo & culture::to_bits(state.world.political_party_get_ideology(pid))) != 0) {
+			party_votes.push_back(party_vote{pid, 0.0f});
+		}
+	}
+
+	if(party_votes.size() == 0)
+		return; // ERROR: no valid parties
+
+	auto const party_count = party_votes.size();
+	auto const issue_count = state.culture_definitions.party_issues.size();
+
+	std::vector<party_tally_entry> provincial_party_votes(party_count);
+	// the demographic keys of each party's positions, party-major
+	std::vector<dcon::pop_demographics_key> party_issue_keys(party_count * issue_count);
+
+	for(size_t j = 0; j < party_count; ++j) {
+		auto par = party_votes[j].par;
+		auto ideology = state.world.political_party_get_ideology(par);
+		provincial_party_votes[j].par = par;
+		provincial_party_votes[j].ideology = ideology;
+		provincial_party_votes[j].ideology_key = pop_demographics::to_key(state, ideology);
+		for(size_t k = 0; k < issue_count; ++k) {
+			auto party_pos = state.world.political_party_get_party_issues(par, state.culture_definitions.party_issues[k]);
+			party_issue_keys[j * issue_count + k] = pop_demographics::to_key(state, party_pos);
+		}
+	}
+
+	auto ruling_party = state.world.nation_get_ruling_party(n);
+	auto national_rule = state.world.nation_get_combined_issue_rules(n);
+	auto national_ruling_party_support = state.world.nation_get_modifier_values(n, sys::national_mod_offsets::ruling_party_support);
 
-				party_votes.clear();
-				float total_vote = 0.0f;
+	// - Determine the vote in each province. Note that voting is *by active party* not by ideology.
+	for(auto p : state.world.nation_get_province_ownership(n)) {
+		if(p.get_province().get_is_colonial())
+			continue; // skip colonial provinces
 
-				auto tag = state.world.nation_get_identity_from_identity_holder(n);
-				auto start = state.world.national_identity_get_political_party_first(tag).id.index();
-				auto end = start + state.world.national_identity_get_political_party_count(tag);
+		float province_total = 0.0f;
+		for(auto& par : provincial_party_votes) {
+			par.vote = 0.0f;
+		}
 
-				for(int32_t i = start; i < end; i++) {
-					auto pid = dcon::political_party_id(dcon::political_party_id::value_base_t(i));
-					if(politics::political_party_is_active(state, pid) &&
-							(n.get_government_type().get_ideologies_allowed() & culture::to_bits(state.world.political_party_get_ideology(pid))) != 0) {
-						party_votes.push_back(party_vote{pid, 0.0f});
+		float ruling_party_support =
+				p.get_province().get_modifier_values(sys::provincial_mod_offsets::local_ruling_party_support) +
+				national_ruling_party_support + 1.0f;
+		float prov_vote_mod = p.get_province().get_modifier_values(sys::provincial_mod_offsets::number_of_voters) + 1.0f;
+
+		for(auto pop : p.get_province().get_pop_location()) {
+			auto weight = pop_vote_weight(state, pop.get_pop(), n);
+			if(weight > 0) {
+				auto ideological_share = pop.get_pop().get_consciousness() / 20.0f;
+				for(size_t j = 0; j < party_count; ++j) {
+					auto& par = provincial_party_votes[j];
+					/*
+					- For each party we do the following: figure out the pop's ideological support for the party and
+					its issues based support for the party (by summing up its support for each issue that the party
+					has set, except that pops of non-accepted cultures will never support more restrictive culture
+					voting parties). The pop then votes for the party (i.e. contributes its voting weight in support)
+					based on the sum of its issue and ideological support, except that the greater consciousness the
+					pop has, the more its vote is based on ideological support (pops with 0 consciousness vote based
+					on issues alone). The support for the party is then multiplied by
+					(provincial-modifier-ruling-party-support + national-modifier-ruling-party-support + 1), if it is
+					the ruling party, and by (1 + province-party-loyalty) for its ideology.
+					- Pop votes are also multiplied by (provincial-modifier-number-of-voters + 1)
+					*/
+					auto base_support = (p.get_province().get_party_loyalty(par.ideology) + 1.0f) * prov_vote_mod *
+															(par.par == ruling_party ? ruling_party_support : 1.0f) * weight;
+					auto issue_support = 0.0f;
+					for(size_t k = 0; k < issue_count; ++k) {
+						issue_support += pop.get_pop().get_demographics(party_issue_keys[j * issue_count + k]);
 					}
+					auto ideology_support = pop.get_pop().get_demographics(par.ideology_key);
+					auto total_support =
+							base_support * (issue_support * (1.0f - ideological_share) + ideology_support * ideological_share);
+
+					province_total += total_support;
+					par.vote += total_support;
 				}
+			}
+		}
 
-				if(party_votes.size() == 0) {
-					continue; // ERROR: no valid parties
+		if(province_total > 0) {
+			/*
+			- After the vote has occurred in each province, the winning party there has the province's ideological
+			loyalty for its ideology increased by define:LOYALTY_BOOST_ON_PARTY_WIN x
+			(provincial-boost-strongest-party-modifier + 1) x fraction-of-vote-for-winning-party
+			- If voting rule "largest_share" is in effect: all votes are added to the sum towards the party that
+			recieved the most votes in the province. If it is "dhont", then the votes in each province are normalized
+			to the number of votes from the province, and for "sainte_laque" the votes from the provinces are simply
+			summed up.
+			*/
+
+			uint32_t winner = 0;
+			float winner_amount = provincial_party_votes[0].vote;
+			for(uint32_t i = 1; i < provincial_party_votes.size(); ++i) {
+				if(provincial_party_votes[i].vote > winner_amount) {
+					winner = i;
+					winner_amount = provincial_party_votes[i].vote;
 				}
+			}
 
-				// - Determine the vote in each province. Note that voting is *by active party* not by ideology.
-				for(auto p : n.get_province_ownership()) {
-					if(p.get_province().get_is_colonial())
-						continue; // skip colonial provinces
+			auto pid = provincial_party_votes[winner].ideology;
+			auto& l = p.get_province().get_party_loyalty(pid);
+			l = std::clamp(
+					l + state.defines.loyalty_boost_on_party_win *
+									(p.get_province().get_modifier_values(sys::provincial_mod_offsets::boost_strongest_party) + 1.0f) *
+									winner_amount / province_total,
+					-1.0f, 1.0f);
+
+			if((national_rule & issue_rule::largest_share) != 0) {
+				party_votes[winner].vote += winner_amount;
+			} else if((national_rule & issue_rule::dhont) != 0) {
+				for(uint32_t i = 0; i < provincial_party_votes.size(); ++i) {
+					party_votes[i].vote += provincial_party_votes[i].vote / province_total;
+				}
+			} else /*if((national_rule & issue_rule::sainte_laque) != 0)*/ {
+				for(uint32_t i = 0; i < provincial_party_votes.size(); ++i) {
+					party_votes[i].vote += provincial_party_votes[i].vote;
+				}
+			}
+		}
+	}
+}
 
-					provincial_party_votes.clear();
-					float province_total = 0.0f;
-					for(auto& par : party_votes) {
-						provincial_party_votes.push_back(party_vote{par.par, 0.0f});
-					}
+void update_elections(sys::state& state) {
+	// first, tally the elections ending today. These are independent of each other and so are done in parallel
+	static std::vector<dcon::nation_id> ending;
+	static std::vector<std::vector<party_vote>> results;
+	ending.clear();
+	for(auto n : state.world.in_nation) {
+		if(has_elections(state, n) && n.get_election_ends() == state.current_date)
+			ending.push_back(n);
+	}
+	if(results.size() < ending.size())
+		results.resize(ending.size());
+	concurrency::parallel_for(uint32_t(0), uint32_t(ending.size()), [&](uint32_t i) {
+		tally_election(state, ending[i], results[i]);
+	});
 
-					float ruling_party_support =
-							p.get_province().get_modifier_values(sys::provincial_mod_offsets::local_ruling_party_support) +
-							n.get_modifier_values(sys::national_mod_offsets::ruling_party_support) + 1.0f;
-					float prov_vote_mod = p.get_province().get_modifier_values(sys::provincial_mod_offsets::number_of_voters) + 1.0f;
-
-					for(auto pop : p.get_province().get_pop_location()) {
-						auto weight = pop_vote_weight(state, pop.get_pop(), n);
-						if(weight > 0) {
-							auto ideological_share = pop.get_pop().get_consciousness() / 20.0f;
-							for(auto& par : provincial_party_votes) {
-								/*
-								- For each party we do the following: figure out the pop's ideological support for the party and
-								its issues based support for the party (by summing up its support for each issue that the party
-								has set, except that pops of non-accepted cultures will never support more restrictive culture
-								voting parties). The pop then votes for the party (i.e. contributes its voting weight in support)
-								based on the sum of its issue and ideological support, except that the greater consciousness the
-								pop has, the more its vote is based on ideological support (pops with 0 consciousness vote based
-								on issues alone). The support for the party is then multiplied by
-								(provincial-modifier-ruling-party-support + national-modifier-ruling-party-support + 1), if it is
-								the ruling party, and by (1 + province-party-loyalty) for its ideology.
-								- Pop votes are also multiplied by (provincial-modifier-number-of-voters + 1)
-								*/
-								auto pid = state.world.political_party_get_ideology(par.par);
-								auto base_support = (p.get_province().get_party_loyalty(pid) + 1.0f) * prov_vote_mod *
-																		(par.par == n.get_ruling_party() ? ruling_party_support : 1.0f) * weight;
-								auto issue_support = 0.0f;
-								for(auto pi : state.culture_definitions.party_issues) {
-									auto party_pos = state.world.political_party_get_party_issues(par.par, pi);
-									issue_support += pop.get_pop().get_demographics(pop_demographics::to_key(state, party_pos));
-								}
-								auto ideology_support = pop.get_pop().get_demographics(pop_demographics::to_key(state, pid));
-								auto total_support =
-										base_support * (issue_support * (1.0f - ideological_share) + ideology_support * ideological_share);
-
-								province_total += total_support;
-								par.vote += total_support;
-							}
-						}
-					}
+	uint32_t next_result = 0;
+	for(auto n : state.world.in_nation) {
+		bool ends_today = next_result < ending.size() && ending[next_result] == n.id;
+		uint32_t result_index = next_result;
+		if(ends_today)
+			++next_result;
 
-					if(province_total > 0) {
-						/*
-						- After the vote has occurred in each province, the winning party there has the province's ideological
-						loyalty for its ideology increased by define:LOYALTY_BOOST_ON_PARTY_WIN x
-						(provincial-boost-strongest-party-modifier + 1) x fraction-of-vote-for-winning-party
-						- If voting rule "largest_share" is in effect: all votes are added to the sum towards the party that
-						recieved the most votes in the province. If it is "dhont", then the votes in each province are normalized
-						to the number of votes from the province, and for "sainte_laque" the votes from the provinces are simply
-						summed up.
-						*/
-
-						uint32_t winner = 0;
-						float winner_amount = provincial_party_votes[0].vote;
-						for(uint32_t i = 1; i < provincial_party_votes.size(); ++i) {
-							if(provincial_party_votes[i].vote > winner_amount) {
-								winner = i;
-								winner_amount = provincial_party_votes[i].vote;
-							}
-						}
+		/*
+		A country with elections starts one every 5 years.
+		Elections last define:CAMPAIGN_DURATION months.
+		*/
+		if(has_elections(state, n)) {
+			if(ends_today) {
+				// make election results
+				auto& party_votes = results[result_index];
 
-						auto pid = state.world.political_party_get_ideology(provincial_party_votes[winner].par);
-						auto& l = p.get_province().get_party_loyalty(pid);
-						l = std::clamp(
-								l + state.defines.loyalty_boost_on_party_win *
-												(p.get_province().get_modifier_values(sys::provincial_mod_offsets::boost_strongest_party) + 1.0f) *
-												winner_amount / province_total,
-								-1.0f, 1.0f);
-						auto national_rule = n.get_combined_issue_rules();
-
-						if((national_rule & issue_rule::largest_share) != 0) {
-							party_votes[winner].vote += winner_amount;
-						} else if((national_rule & issue_rule::dhont) != 0) {
-							for(uint32_t i = 0; i < provincial_party_votes.size(); ++i) {
-								party_votes[i].vote += provincial_party_votes[i].vote / province_total;
-							}
-						} else /*if((national_rule & issue_rule::sainte_laque) != 0)*/ {
-							for(uint32_t i = 0; i < provincial_party_votes.size(); ++i) {
-								party_votes[i].vote += provincial_party_votes[i].vote;
-							}
-						}
-					}
+				if(party_votes.size() == 0) {
+					continue; // ERROR: no valid parties
 				}
 
 				/*
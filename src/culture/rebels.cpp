@@ -186,129 +186,173 @@ bool movement_is_valid(sys::state& state, dcon::movement_id m) {
 	return false;
 }
 
-void update_pop_movement_membership(sys::state& state) {
-	state.world.for_each_pop([&](dcon::pop_id p) {
-		auto owner = nations::owner_of_pop(state, p);
-		// pops not in a nation can't be in a movement
-		if(!owner)
-			return;
-
-		// - Slave pops cannot belong to a movement
-		if(state.world.pop_get_poptype(p) == state.culture_definitions.slaves)
-			return;
-		// pops in rebel factions don't join movements
-		if(state.world.pop_get_rebel_faction_from_pop_rebellion_membership(p))
-			return;
-
-		auto pop_location = state.world.pop_get_province_from_pop_location(p);
-		// pops in colonial provinces don't join movements
-		if(state.world.province_get_is_colonial(pop_location))
-			return;
-
-		auto existing_movement = state.world.pop_get_movement_from_pop_movement_membership(p);
-		auto mil = state.world.pop_get_militancy(p);
-
-		// -Pops with define : MIL_TO_JOIN_REBEL or greater militancy cannot join a movement
-		if(mil >= state.defines.mil_to_join_rebel) {
-			remove_pop_from_movement(state, p);
-			return;
-		}
-		if(existing_movement) {
-			auto i =
-					state.world.movement_get_associated_issue_option(existing_movement);
-			if(i) {
-				auto support = state.world.pop_get_demographics(p, pop_demographics::to_key(state, i));
-				if(support * 100.0f < state.defines.issue_movement_leave_limit) {
-					// If the pop's support of the issue for an issue-based movement drops below define:ISSUE_MOVEMENT_LEAVE_LIMIT
-					// the pop will leave the movement.
-					remove_pop_from_movement(state, p);
-					return;
-				}
-			} else if(mil < state.defines.nationalist_movement_mil_cap) {
-				// If the pop's militancy falls below define:NATIONALIST_MOVEMENT_MIL_CAP, the pop will leave an independence
-				// movement.
-				remove_pop_from_movement(state, p);
-				return;
+enum class movement_membership_action : uint8_t {
+	none, leave, join_issue, join_independence
+};
+
+struct pop_movement_choice {
+	dcon::issue_option_id option;
+	dcon::national_identity_id independence;
+	movement_membership_action action = movement_membership_action::none;
+};
+
+pop_movement_choice choose_pop_movement(sys::state& state, dcon::pop_id p) {
+	auto owner = nations::owner_of_pop(state, p);
+	// pops not in a nation can't be in a movement
+	if(!owner)
+		return pop_movement_choice{};
+
+	// - Slave pops cannot belong to a movement
+	if(state.world.pop_get_poptype(p) == state.culture_definitions.slaves)
+		return pop_movement_choice{};
+	// pops in rebel factions don't join movements
+	if(state.world.pop_get_rebel_faction_from_pop_rebellion_membership(p))
+		return pop_movement_choice{};
+
+	auto pop_location = state.world.pop_get_province_from_pop_location(p);
+	// pops in colonial provinces don't join movements
+	if(state.world.province_get_is_colonial(pop_location))
+		return pop_movement_choice{};
+
+	auto existing_movement = state.world.pop_get_movement_from_pop_movement_membership(p);
+	auto mil = state.world.pop_get_militancy(p);
+
+	// -Pops with define : MIL_TO_JOIN_REBEL or greater militancy cannot join a movement
+	if(mil >= state.defines.mil_to_join_rebel) {
+		return pop_movement_choice{ dcon::issue_option_id{}, dcon::national_identity_id{}, movement_membership_action::leave };
+	}
+	if(existing_movement) {
+		auto i =
+				state.world.movement_get_associated_issue_option(existing_movement);
+		if(i) {
+			auto support = state.world.pop_get_demographics(p, pop_demographics::to_key(state, i));
+			if(support * 100.0f < state.defines.issue_movement_leave_limit) {
+				// If the pop's support of the issue for an issue-based movement drops below define:ISSUE_MOVEMENT_LEAVE_LIMIT
+				// the pop will leave the movement.
+				return pop_movement_choice{ dcon::issue_option_id{}, dcon::national_identity_id{}, movement_membership_action::leave };
 			}
-			// pop still remains in movement, no more work to do
-			return;
+		} else if(mil < state.defines.nationalist_movement_mil_cap) {
+			// If the pop's militancy falls below define:NATIONALIST_MOVEMENT_MIL_CAP, the pop will leave an independence
+			// movement.
+			return pop_movement_choice{ dcon::issue_option_id{}, dcon::national_identity_id{}, movement_membership_action::leave };
 		}
+		// pop still remains in movement, no more work to do
+		return pop_movement_choice{};
+	}
 
-		auto con = state.world.pop_get_consciousness(p);
-		auto lit = state.world.pop_get_literacy(p);
+	auto con = state.world.pop_get_consciousness(p);
+	auto lit = state.world.pop_get_literacy(p);
 
-		// a pop with a consciousness of at least 1.5 or a literacy of at least 0.25 may join a movement
-		if(con >= 1.5f || lit >= 0.25f) {
-			/*
-			- If there are one or more issues that the pop supports by at least define:ISSUE_MOVEMENT_JOIN_LIMIT, then the pop has
-			a chance to join an issue-based movement at probability: issue-support x 9 x define:MOVEMENT_LIT_FACTOR x pop-literacy
-			+ issue-support x 9 x define:MOVEMENT_CON_FACTOR x pop-consciousness
-			*/
-			dcon::issue_option_id max_option;
-			float max_support = 0;
-			state.world.for_each_issue_option([&](dcon::issue_option_id io) {
-				auto parent = state.world.issue_option_get_parent_issue(io);
-				auto co = state.world.nation_get_issues(owner, parent);
-				auto allow = state.world.issue_option_get_allow(io);
-				if(co != io && (state.world.issue_get_issue_type(parent) == uint8_t(culture::issue_type::social) || state.world.issue_get_issue_type(parent) == uint8_t(culture::issue_type::political))) { // filter out currently active issue
-					auto sup = state.world.pop_get_demographics(p, pop_demographics::to_key(state, io));
-					if(sup * 100.0f >= state.defines.issue_movement_join_limit && sup > max_support) { // filter out -- above limit thersholds
-						/*
-						then the pop has a chance to join an issue-based movement at probability: issue-support x 9 x define:MOVEMENT_LIT_FACTOR x pop-literacy + issue-support x 9 x define:MOVEMENT_CON_FACTOR x pop-consciousness
-						*/
-
-						// probability test
-						auto fp_prob = 9.0f * sup * (state.defines.movement_lit_factor * lit + state.defines.movement_con_factor * con);
-						auto rvalue = float(uint32_t(rng::get_random(state, (p.value << 3) ^ io.index()) & 0xFFFF)) / float(0x10000);
-						if(rvalue < fp_prob) {
-
-							// is this issue possible to get by law?
-							if(state.world.issue_get_is_next_step_only(parent) == false || co.id.index() + 1 == io.index() || co.id.index() - 1 == io.index()) {
-
-								max_option = io;
-								max_support = sup;
-							}
+	// a pop with a consciousness of at least 1.5 or a literacy of at least 0.25 may join a movement
+	if(con >= 1.5f || lit >= 0.25f) {
+		/*
+		- If there are one or more issues that the pop supports by at least define:ISSUE_MOVEMENT_JOIN_LIMIT, then the pop has
+		a chance to join an issue-based movement at probability: issue-support x 9 x define:MOVEMENT_LIT_FACTOR x pop-literacy
+		+ issue-support x 9 x define:MOVEMENT_CON_FACTOR x pop-consciousness
+		*/
+		dcon::issue_option_id max_option;
+		float max_support = 0;
+		state.world.for_each_issue_option([&](dcon::issue_option_id io) {
+			auto parent = state.world.issue_option_get_parent_issue(io);
+			auto co = state.world.nation_get_issues(owner, parent);
+			auto allow = state.world.issue_option_get_allow(io);
+			if(co != io && (state.world.issue_get_issue_type(parent) == uint8_t(culture::issue_type::social) || state.world.issue_get_issue_type(parent) == uint8_t(culture::issue_type::political))) { // filter out currently active issue
+				auto sup = state.world.pop_get_demographics(p, pop_demographics::to_key(state, io));
+				if(sup * 100.0f >= state.defines.issue_movement_join_limit && sup > max_support) { // filter out -- above limit thersholds
+					/*
+					then the pop has a chance to join an issue-based movement at probability: issue-support x 9 x define:MOVEMENT_LIT_FACTOR x pop-literacy + issue-support x 9 x define:MOVEMENT_CON_FACTOR x pop-consciousness
+					*/
+
+					// probability test
+					auto fp_prob = 9.0f * sup * (state.defines.movement_lit_factor * lit + state.defines.movement_con_factor * con);
+					auto rvalue = float(uint32_t(rng::get_random(state, (p.value << 3) ^ io.index()) & 0xFFFF)) / float(0x10000);
+					if(rvalue < fp_prob) {
+
+						// is this issue possible to get by law?
+						if(state.world.issue_get_is_next_step_only(parent) == false || co.id.index() + 1 == io.index() || co.id.index() - 1 == io.index()) {
+
+							max_option = io;
+							max_support = sup;
 						}
 					}
 				}
-			});
+			}
+		});
 
-			if(max_option) {
-				if(auto m = get_movement_by_position(state, owner, max_option); m) {
-					add_pop_to_movement(state, p, m);
-				} else if(issue_is_valid_for_movement(state, owner, max_option)) {
-					auto new_movement = fatten(state.world, state.world.create_movement());
-					new_movement.set_associated_issue_option(max_option);
-					state.world.try_create_movement_within(new_movement, owner);
-					add_pop_to_movement(state, p, new_movement);
-				}
-			} else if(!state.world.pop_get_is_primary_or_accepted_culture(p) && mil >= state.defines.nationalist_movement_mil_cap) {
-				/*
-				- If there are no valid issues, the pop has a militancy of at least define:NATIONALIST_MOVEMENT_MIL_CAP, does not
-				have the primary culture of the nation it is in, and does have the primary culture of some core in its province,
-				then it has a chance (20% ?) of joining an independence movement for such a core.
-				*/
-				if(rng::reduce(uint32_t(rng::get_random(state, p.value)), 10) != 0) {
-					return; // exit out of considering this pop
-				}
-				auto pop_culture = state.world.pop_get_culture(p);
-				for(auto c : state.world.province_get_core(pop_location)) {
-					if(c.get_identity().get_primary_culture() == pop_culture) {
-						auto existing_mov = get_movement_by_independence(state, owner, c.get_identity());
-						if(existing_mov) {
-							state.world.try_create_pop_movement_membership(p, existing_mov);
-						} else {
-							auto new_mov = fatten(state.world, state.world.create_movement());
-							new_mov.set_associated_independence(c.get_identity());
-							state.world.try_create_movement_within(new_mov, owner);
-							state.world.try_create_pop_movement_membership(p, new_mov);
-						}
-						break;
-					}
+		if(max_option) {
+			return pop_movement_choice{ max_option, dcon::national_identity_id{}, movement_membership_action::join_issue };
+		} else if(!state.world.pop_get_is_primary_or_accepted_culture(p) && mil >= state.defines.nationalist_movement_mil_cap) {
+			/*
+			- If there are no valid issues, the pop has a militancy of at least define:NATIONALIST_MOVEMENT_MIL_CAP, does not
+			have the primary culture of the nation it is in, and does have the primary culture of some core in its province,
+			then it has a chance (20% ?) of joining an independence movement for such a core.
+			*/
+			if(rng::reduce(uint32_t(rng::get_random(state, p.value)), 10) != 0) {
+				return pop_movement_choice{}; // exit out of considering this pop
+			}
+			auto pop_culture = state.world.pop_get_culture(p);
+			for(auto c : state.world.province_get_core(pop_location)) {
+				if(c.get_identity().get_primary_culture() == pop_culture) {
+					return pop_movement_choice{ dcon::issue_option_id{}, c.get_identity().id, movement_membership_action::join_independence };
 				}
 			}
 		}
+	}
+	return pop_movement_choice{};
+}
+
+void update_pop_movement_membership(sys::state& state) {
+	/*
+	What a pop wants to do depends only on its own state, so the choices are made in parallel. They are then applied in pop
+	order, since applying them creates movements that pops later in the order will join.
+	*/
+	static std::vector<pop_movement_choice> choices;
+	choices.clear();
+	choices.resize(state.world.pop_size());
+
+	concurrency::parallel_for(uint32_t(0), state.world.pop_size(), [&](uint32_t i) {
+		choices[i] = choose_pop_movement(state, dcon::pop_id{ dcon::pop_id::value_base_t(i) });
 	});
+
+	for(uint32_t i = 0; i < uint32_t(choices.size()); ++i) {
+		dcon::pop_id p{ dcon::pop_id::value_base_t(i) };
+		auto const& choice = choices[i];
+
+		switch(choice.action) {
+		case movement_membership_action::none:
+			break;
+		case movement_membership_action::leave:
+			remove_pop_from_movement(state, p);
+			break;
+		case movement_membership_action::join_issue:
+		{
+			auto owner = nations::owner_of_pop(state, p);
+			if(auto m = get_movement_by_position(state, owner, choice.option); m) {
+				add_pop_to_movement(state, p, m);
+			} else if(issue_is_valid_for_movement(state, owner, choice.option)) {
+				auto new_movement = fatten(state.world, state.world.create_movement());
+				new_movement.set_associated_issue_option(choice.option);
+				state.world.try_create_movement_within(new_movement, owner);
+				add_pop_to_movement(state, p, new_movement);
+			}
+			break;
+		}
+		case movement_membership_action::join_independence:
+		{
+			auto owner = nations::owner_of_pop(state, p);
+			auto existing_mov = get_movement_by_independence(state, owner, choice.independence);
+			if(existing_mov) {
+				state.world.try_create_pop_movement_membership(p, existing_mov);
+			} else {
+				auto new_mov = fatten(state.world, state.world.create_movement());
+				new_mov.set_associated_independence(choice.independence);
+				state.world.try_create_movement_within(new_mov, owner);
+				state.world.try_create_pop_movement_membership(p, new_mov);
+			}
+			break;
+		}
+		}
+	}
 }
 
 void update_movements(sys::state& state) { // updates cached values and then possibly turns movements into rebels
@@ -427,271 +471,303 @@ bool pop_is_compatible_with_rebel_type(sys::state& state, dcon::pop_id p, dcon::
 	return true;
 }
 
-void update_pop_rebel_membership(sys::state& state) {
-	state.world.for_each_pop([&](dcon::pop_id p) {
-		auto owner = nations::owner_of_pop(state, p);
-		// pops not in a nation can't be in a rebel faction
-		if(!owner)
-			return;
+/*
+* Sets up a temporary faction of the given type so that its spawn chance can be evaluated for the pop.
+* Returns false if the pop could never form a faction of that type.
+*/
+bool setup_temporary_faction(sys::state& state, dcon::pop_id p, dcon::rebel_faction_id temp, dcon::rebel_type_id rt, dcon::national_identity_id ind_tag) {
+	state.world.rebel_faction_set_type(temp, rt);
+	state.world.rebel_faction_set_defection_target(temp, dcon::national_identity_id{});
+	state.world.rebel_faction_set_primary_culture(temp, dcon::culture_id{});
+	state.world.rebel_faction_set_primary_culture_group(temp, dcon::culture_group_id{});
+	state.world.rebel_faction_set_religion(temp, dcon::religion_id{});
+
+	switch(culture::rebel_defection(state.world.rebel_type_get_defection(rt))) {
+	case culture::rebel_defection::culture:
+		state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
+		state.world.rebel_faction_set_defection_target(temp, ind_tag);
+		if(!ind_tag)
+			return false; // skip -- no defection possible
+		if(state.world.pop_get_is_primary_or_accepted_culture(p))
+			return false; // skip -- can't defect
+		break;
+	case culture::rebel_defection::culture_group:
+		state.world.rebel_faction_set_primary_culture_group(temp,
+				state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
+		state.world.rebel_faction_set_defection_target(temp, ind_tag);
+		if(!ind_tag)
+			return false; // skip -- no defection possible
+		if(state.world.pop_get_is_primary_or_accepted_culture(p))
+			return false; // skip -- can't defect
+		break;
+	case culture::rebel_defection::religion:
+		state.world.rebel_faction_set_religion(temp, state.world.pop_get_religion(p));
+		state.world.rebel_faction_set_defection_target(temp, ind_tag);
+		if(!ind_tag)
+			return false; // skip -- no defection possible
+		if(state.world.pop_get_is_primary_or_accepted_culture(p))
+			return false; // skip -- can't defect
+		break;
+	case culture::rebel_defection::pan_nationalist: {
+		auto cg = state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p));
+		auto u = state.world.culture_group_get_identity_from_cultural_union_of(cg);
+		if(!u)
+			return false; // skip -- no pan nationalist possible
+		state.world.rebel_faction_set_defection_target(temp, u);
+		break;
+	}
+	case culture::rebel_defection::any:
+		state.world.rebel_faction_set_defection_target(temp, ind_tag);
+		if(!ind_tag)
+			return false; // skip -- no defection possible
+		if(state.world.pop_get_is_primary_or_accepted_culture(p))
+			return false; // skip -- can't defect
+		break;
+	default:
+		break;
+	}
 
-		auto mil = state.world.pop_get_militancy(p);
-		auto existing_faction = state.world.pop_get_rebel_faction_from_pop_rebellion_membership(p);
+	switch(culture::rebel_independence(state.world.rebel_type_get_independence(rt))) {
+	case culture::rebel_independence::culture:
+		state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
+		state.world.rebel_faction_set_defection_target(temp, ind_tag);
+		if(!ind_tag)
+			return false; // skip -- no defection possible
+		if(state.world.pop_get_is_primary_or_accepted_culture(p))
+			return false; // skip -- can't defect
+		break;
+	case culture::rebel_independence::culture_group:
+		state.world.rebel_faction_set_primary_culture_group(temp,
+				state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
+		state.world.rebel_faction_set_defection_target(temp, ind_tag);
+		if(!ind_tag)
+			return false; // skip -- no defection possible
+		if(state.world.pop_get_is_primary_or_accepted_culture(p))
+			return false; // skip -- can't defect
+		break;
+	case culture::rebel_independence::religion:
+		state.world.rebel_faction_set_religion(temp, state.world.pop_get_religion(p));
+		state.world.rebel_faction_set_defection_target(temp, ind_tag);
+		if(!ind_tag)
+			return false; // skip -- no defection possible
+		if(state.world.pop_get_is_primary_or_accepted_culture(p))
+			return false; // skip -- can't defect
+		break;
+	case culture::rebel_independence::pan_nationalist: {
+		auto cg = state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p));
+		auto u = state.world.culture_group_get_identity_from_cultural_union_of(cg);
+		if(!u)
+			return false; // skip -- no pan nationalist possible
+		if(state.world.pop_get_is_primary_or_accepted_culture(p))
+			return false; // skip -- can't defect
+		state.world.rebel_faction_set_defection_target(temp, u);
+		break;
+	}
+	case culture::rebel_independence::any:
+		state.world.rebel_faction_set_defection_target(temp, ind_tag);
+		if(!ind_tag)
+			return false; // skip -- no defection possible
+		if(state.world.pop_get_is_primary_or_accepted_culture(p))
+			return false; // skip -- can't defect
+		break;
+	case culture::rebel_independence::colonial:
+		state.world.rebel_faction_set_defection_target(temp, ind_tag);
+		if(!ind_tag)
+			return false; // skip -- no defection possible
+		if(state.world.pop_get_is_primary_or_accepted_culture(p))
+			return false; // skip -- can't defect
+		break;
+	default:
+		break;
+	}
+	return true;
+}
 
-		// -Pops with define : MIL_TO_JOIN_REBEL will join a rebel_faction
-		if(mil >= state.defines.mil_to_join_rebel) {
-			if(existing_faction && !pop_is_compatible_with_rebel_faction(state, p, existing_faction)) {
-				remove_pop_from_rebel_faction(state, p);
-			} else {
-				auto prov = state.world.pop_get_province_from_pop_location(p);
-				/*
-				- A pop in a province sieged or controlled by rebels will join that faction, if the pop is compatible with the
-				faction.
-				*/
-
-				auto occupying_faction = state.world.province_get_rebel_faction_from_province_rebel_control(prov);
-				if(occupying_faction && pop_is_compatible_with_rebel_faction(state, p, occupying_faction)) {
-					assert(!bool(state.world.province_get_nation_from_province_control(prov)));
-					add_pop_to_rebel_faction(state, p, occupying_faction);
-				} else {
-					/*
-					- Otherwise take all the compatible and possible rebel types. Determine the spawn chance for each of them, by
-					taking the *product* of the modifiers. The pop then joins the type with the greatest chance (that's right, it
-					isn't really a *chance* at all). If that type has a defection type, it joins the faction with the national
-					identity most compatible with it and that type (pan-nationalist go to the union tag, everyone else uses the
-					logic I outline below)
-					*/
-					float greatest_chance = 0.0f;
-					dcon::rebel_faction_id f;
-					for(auto rf : state.world.nation_get_rebellion_within(owner)) {
-						if(pop_is_compatible_with_rebel_faction(state, p, rf.get_rebels())) {
-							auto chance = rf.get_rebels().get_type().get_spawn_chance();
-							auto eval = trigger::evaluate_multiplicative_modifier(state, chance, trigger::to_generic(p),
-									trigger::to_generic(owner), trigger::to_generic(rf.get_rebels().id));
-							if(eval > greatest_chance) {
-								f = rf.get_rebels();
-								greatest_chance = eval;
-							}
-						}
-					}
+dcon::national_identity_id independence_tag_for_pop(sys::state& state, dcon::pop_id p) {
+	auto prov = state.world.pop_get_province_from_pop_location(p);
+	for(auto core : state.world.province_get_core(prov)) {
+		if(!core.get_identity().get_is_not_releasable() && core.get_identity().get_primary_culture() == state.world.pop_get_culture(p))
+			return core.get_identity().id;
+	}
+	return dcon::national_identity_id{};
+}
 
-					dcon::rebel_faction_id temp = state.world.create_rebel_faction();
-					dcon::national_identity_id ind_tag = [&]() {
-						auto prov = state.world.pop_get_province_from_pop_location(p);
-						for(auto core : state.world.province_get_core(prov)) {
-							if(!core.get_identity().get_is_not_releasable() && core.get_identity().get_primary_culture() == state.world.pop_get_culture(p))
-								return core.get_identity().id;
-						}
-						return dcon::national_identity_id{};
-					}();
-
-					dcon::rebel_type_id max_type;
-
-					state.world.for_each_rebel_type([&](dcon::rebel_type_id rt) {
-						if(pop_is_compatible_with_rebel_type(state, p, rt)) {
-							state.world.rebel_faction_set_type(temp, rt);
-							state.world.rebel_faction_set_defection_target(temp, dcon::national_identity_id{});
-							state.world.rebel_faction_set_primary_culture(temp, dcon::culture_id{});
-							state.world.rebel_faction_set_primary_culture_group(temp, dcon::culture_group_id{});
-							state.world.rebel_faction_set_religion(temp, dcon::religion_id{});
-
-							switch(culture::rebel_defection(state.world.rebel_type_get_defection(rt))) {
-							case culture::rebel_defection::culture:
-								state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							case culture::rebel_defection::culture_group:
-								state.world.rebel_faction_set_primary_culture_group(temp,
-										state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							case culture::rebel_defection::religion:
-								state.world.rebel_faction_set_religion(temp, state.world.pop_get_religion(p));
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							case culture::rebel_defection::pan_nationalist: {
-								auto cg = state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p));
-								auto u = state.world.culture_group_get_identity_from_cultural_union_of(cg);
-								if(!u)
-									return; // skip -- no pan nationalist possible
-								state.world.rebel_faction_set_defection_target(temp, u);
-								break;
-							}
-							case culture::rebel_defection::any:
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							default:
-								break;
-							}
+enum class rebel_membership_action : uint8_t {
+	none, leave, join_occupier, choose
+};
 
-							switch(culture::rebel_independence(state.world.rebel_type_get_independence(rt))) {
-							case culture::rebel_independence::culture:
-								state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							case culture::rebel_independence::culture_group:
-								state.world.rebel_faction_set_primary_culture_group(temp,
-										state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							case culture::rebel_independence::religion:
-								state.world.rebel_faction_set_religion(temp, state.world.pop_get_religion(p));
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							case culture::rebel_independence::pan_nationalist: {
-								auto cg = state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p));
-								auto u = state.world.culture_group_get_identity_from_cultural_union_of(cg);
-								if(!u)
-									return; // skip -- no pan nationalist possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								state.world.rebel_faction_set_defection_target(temp, u);
-								break;
-							}
-							case culture::rebel_independence::any:
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							case culture::rebel_independence::colonial:
-								state.world.rebel_faction_set_defection_target(temp, ind_tag);
-								if(!ind_tag)
-									return; // skip -- no defection possible
-								if(state.world.pop_get_is_primary_or_accepted_culture(p))
-									return; // skip -- can't defect
-								break;
-							default:
-								break;
-							}
+struct pop_rebel_choice {
+	dcon::rebel_faction_id best_existing;	// best among the factions that existed when the update started
+	dcon::rebel_type_id best_new_type;		// best rebel type that a new faction could be formed from
+	float existing_chance = 0.0f;
+	float new_chance = 0.0f;
+	rebel_membership_action action = rebel_membership_action::none;
+};
 
-							auto chance = state.world.rebel_type_get_spawn_chance(rt);
-							auto eval = trigger::evaluate_multiplicative_modifier(state, chance, trigger::to_generic(p),
-									trigger::to_generic(owner), trigger::to_generic(temp));
-							if(eval > greatest_chance) {
-								f = temp;
-								max_type = rt;
-								greatest_chance = eval;
-							}
-						}
-					});
+void update_pop_rebel_membership(sys::state& state) {
+	/*
+	The choice each pop makes depends only on its own state and on the factions that exist at the start of the update, with the
+	exception of factions created during the update itself. Thus the expensive part -- evaluating compatibility and spawn chances
+	against every existing faction and every rebel type -- is done in parallel over blocks of pops, and then the choices are
+	applied serially, in pop order, taking into account the factions created by pops earlier in the order.
+	*/
 
-					if(f != temp) {
-						state.world.delete_rebel_faction(temp);
-					} else {
-						auto rt = max_type;
-						state.world.rebel_faction_set_type(temp, rt);
-						state.world.rebel_faction_set_defection_target(temp, dcon::national_identity_id{});
-						state.world.rebel_faction_set_primary_culture(temp, dcon::culture_id{});
-						state.world.rebel_faction_set_primary_culture_group(temp, dcon::culture_group_id{});
-						state.world.rebel_faction_set_religion(temp, dcon::religion_id{});
-
-						switch(culture::rebel_defection(state.world.rebel_type_get_defection(rt))) {
-						case culture::rebel_defection::culture:
-							state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
-							state.world.rebel_faction_set_defection_target(temp, ind_tag);
-							break;
-						case culture::rebel_defection::culture_group:
-							state.world.rebel_faction_set_primary_culture_group(temp,
-									state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
-							state.world.rebel_faction_set_defection_target(temp, ind_tag);
-							break;
-						case culture::rebel_defection::religion:
-							state.world.rebel_faction_set_religion(temp, state.world.pop_get_religion(p));
-							state.world.rebel_faction_set_defection_target(temp, ind_tag);
-							break;
-						case culture::rebel_defection::pan_nationalist: {
-							auto cg = state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p));
-							auto u = state.world.culture_group_get_identity_from_cultural_union_of(cg);
-							state.world.rebel_faction_set_defection_target(temp, u);
-							break;
-						}
-						case culture::rebel_defection::any:
-							state.world.rebel_faction_set_defection_target(temp, ind_tag);
-							break;
-						default:
-							break;
-						}
+	static std::vector<pop_rebel_choice> choices;
+	choices.clear();
+	choices.resize(state.world.pop_size());
+
+	// each block of pops gets its own temporary faction to evaluate potential new rebel types against
+	constexpr uint32_t block_count = 64;
+	std::array<dcon::rebel_faction_id, block_count> temps;
+	for(uint32_t i = 0; i < block_count; ++i)
+		temps[i] = state.world.create_rebel_faction();
+
+	uint32_t const pop_count = state.world.pop_size();
+	uint32_t const block_size = (pop_count + block_count - 1) / block_count;
+
+	concurrency::parallel_for(uint32_t(0), block_count, [&](uint32_t block) {
+		auto temp = temps[block];
+		auto block_end = std::min(pop_count, (block + 1) * block_size);
+		for(uint32_t i = block * block_size; i < block_end; ++i) {
+			dcon::pop_id p{ dcon::pop_id::value_base_t(i) };
+			auto& choice = choices[i];
+
+			auto owner = nations::owner_of_pop(state, p);
+			// pops not in a nation can't be in a rebel faction
+			if(!owner)
+				continue;
 
-						switch(culture::rebel_independence(state.world.rebel_type_get_independence(rt))) {
-						case culture::rebel_independence::culture:
-							state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
-							state.world.rebel_faction_set_defection_target(temp, ind_tag);
-							break;
-						case culture::rebel_independence::culture_group:
-							state.world.rebel_faction_set_primary_culture_group(temp,
-									state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
-							state.world.rebel_faction_set_defection_target(temp, ind_tag);
-							break;
-						case culture::rebel_independence::religion:
-							state.world.rebel_faction_set_religion(temp, state.world.pop_get_religion(p));
-							state.world.rebel_faction_set_defection_target(temp, ind_tag);
-							break;
-						case culture::rebel_independence::pan_nationalist: {
-							auto cg = state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p));
-							auto u = state.world.culture_group_get_identity_from_cultural_union_of(cg);
-							state.world.rebel_faction_set_defection_target(temp, u);
-							break;
-						}
-						case culture::rebel_independence::any:
-							state.world.rebel_faction_set_defection_target(temp, ind_tag);
-							break;
-						case culture::rebel_independence::colonial:
-							state.world.rebel_faction_set_defection_target(temp, ind_tag);
-							break;
-						default:
-							break;
-						}
+			auto mil = state.world.pop_get_militancy(p);
+			auto existing_faction = state.world.pop_get_rebel_faction_from_pop_rebellion_membership(p);
 
-						if(state.world.rebel_type_get_culture_restriction(rt) && !state.world.rebel_faction_get_primary_culture(temp)) {
-							state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
-						}
-						if(state.world.rebel_type_get_culture_group_restriction(rt) && !state.world.rebel_faction_get_primary_culture_group(temp)) {
-							state.world.rebel_faction_set_primary_culture_group(temp, state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
-						}
+			// - Pops with define : MIL_TO_JOIN_REBEL will join a rebel_faction
+			if(mil < state.defines.mil_to_join_rebel) {
+				if(existing_faction) // less than: MIL_TO_JOIN_REBEL will join a rebel_faction -- leave faction
+					choice.action = rebel_membership_action::leave;
+				continue;
+			}
+			if(existing_faction && !pop_is_compatible_with_rebel_faction(state, p, existing_faction)) {
+				choice.action = rebel_membership_action::leave;
+				continue;
+			}
+
+			/*
+			- A pop in a province sieged or controlled by rebels will join that faction, if the pop is compatible with the
+			faction.
+			*/
+			auto prov = state.world.pop_get_province_from_pop_location(p);
+			auto occupying_faction = state.world.province_get_rebel_faction_from_province_rebel_control(prov);
+			if(occupying_faction && pop_is_compatible_with_rebel_faction(state, p, occupying_faction)) {
+				assert(!bool(state.world.province_get_nation_from_province_control(prov)));
+				choice.action = rebel_membership_action::join_occupier;
+				choice.best_existing = occupying_faction;
+				continue;
+			}
 
-						state.world.try_create_rebellion_within(temp, owner);
+			/*
+			- Otherwise take all the compatible and possible rebel types. Determine the spawn chance for each of them, by
+			taking the *product* of the modifiers. The pop then joins the type with the greatest chance (that's right, it
+			isn't really a *chance* at all). If that type has a defection type, it joins the faction with the national
+			identity most compatible with it and that type (pan-nationalist go to the union tag, everyone else uses the
+			logic I outline below)
+			*/
+			choice.action = rebel_membership_action::choose;
+			for(auto rf : state.world.nation_get_rebellion_within(owner)) {
+				if(pop_is_compatible_with_rebel_faction(state, p, rf.get_rebels())) {
+					auto chance = rf.get_rebels().get_type().get_spawn_chance();
+					auto eval = trigger::evaluate_multiplicative_modifier(state, chance, trigger::to_generic(p),
+							trigger::to_generic(owner), trigger::to_generic(rf.get_rebels().id));
+					if(eval > choice.existing_chance) {
+						choice.best_existing = rf.get_rebels();
+						choice.existing_chance = eval;
 					}
+				}
+			}
 
-					if(greatest_chance > 0) {
-						add_pop_to_rebel_faction(state, p, f);
+			auto ind_tag = independence_tag_for_pop(state, p);
+			state.world.for_each_rebel_type([&](dcon::rebel_type_id rt) {
+				if(pop_is_compatible_with_rebel_type(state, p, rt) && setup_temporary_faction(state, p, temp, rt, ind_tag)) {
+					auto chance = state.world.rebel_type_get_spawn_chance(rt);
+					auto eval = trigger::evaluate_multiplicative_modifier(state, chance, trigger::to_generic(p),
+							trigger::to_generic(owner), trigger::to_generic(temp));
+					if(eval > choice.new_chance) {
+						choice.best_new_type = rt;
+						choice.new_chance = eval;
+					}
+				}
+			});
+		}
+	});
+
+	// rebel factions are compactable, so deleting from the top down leaves every other faction where it was
+	for(uint32_t i = block_count; i-- > 0;)
+		state.world.delete_rebel_faction(temps[i]);
+
+	// factions created by this update, which pops later in the order may also join
+	static std::vector<dcon::rebel_faction_id> created;
+	created.clear();
+
+	for(uint32_t i = 0; i < pop_count; ++i) {
+		dcon::pop_id p{ dcon::pop_id::value_base_t(i) };
+		auto const& choice = choices[i];
+
+		switch(choice.action) {
+		case rebel_membership_action::none:
+			break;
+		case rebel_membership_action::leave:
+			remove_pop_from_rebel_faction(state, p);
+			break;
+		case rebel_membership_action::join_occupier:
+			add_pop_to_rebel_faction(state, p, choice.best_existing);
+			break;
+		case rebel_membership_action::choose:
+		{
+			auto owner = nations::owner_of_pop(state, p);
+			float greatest_chance = choice.existing_chance;
+			dcon::rebel_faction_id f = choice.best_existing;
+
+			for(auto rf : created) {
+				if(state.world.rebel_faction_get_ruler_from_rebellion_within(rf) == owner && pop_is_compatible_with_rebel_faction(state, p, rf)) {
+					auto chance = state.world.rebel_type_get_spawn_chance(state.world.rebel_faction_get_type(rf));
+					auto eval = trigger::evaluate_multiplicative_modifier(state, chance, trigger::to_generic(p),
+							trigger::to_generic(owner), trigger::to_generic(rf));
+					if(eval > greatest_chance) {
+						f = rf;
+						greatest_chance = eval;
 					}
 				}
 			}
-		} else { // less than: MIL_TO_JOIN_REBEL will join a rebel_faction -- leave faction
-			if(existing_faction) {
-				remove_pop_from_rebel_faction(state, p);
+
+			if(choice.new_chance > greatest_chance) {
+				auto rt = choice.best_new_type;
+				auto ind_tag = independence_tag_for_pop(state, p);
+				dcon::rebel_faction_id temp = state.world.create_rebel_faction();
+
+				// the type was only chosen because this setup succeeded for the pop during the parallel phase
+				[[maybe_unused]] bool possible = setup_temporary_faction(state, p, temp, rt, ind_tag);
+				assert(possible);
+
+				if(state.world.rebel_type_get_culture_restriction(rt) && !state.world.rebel_faction_get_primary_culture(temp)) {
+					state.world.rebel_faction_set_primary_culture(temp, state.world.pop_get_culture(p));
+				}
+				if(state.world.rebel_type_get_culture_group_restriction(rt) && !state.world.rebel_faction_get_primary_culture_group(temp)) {
+					state.world.rebel_faction_set_primary_culture_group(temp, state.world.culture_get_group_from_culture_group_membership(state.world.pop_get_culture(p)));
+				}
+
+				state.world.try_create_rebellion_within(temp, owner);
+				created.push_back(temp);
+
+				f = temp;
+				greatest_chance = choice.new_chance;
+			}
+
+			if(greatest_chance > 0) {
+				add_pop_to_rebel_faction(state, p, f);
 			}
+			break;
 		}
-	});
+		}
+	}
 }
 
 void delete_faction(sys::state& state, dcon::rebel_faction_id reb) {
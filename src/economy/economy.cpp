@@ -3063,6 +3063,8 @@ void daily_update(sys::state& state) {
 		}
 		n.set_private_investment(0.0f);
 	}
+
+	update_budget_estimates(state);
 }
 
 void regenerate_unsaved_values(sys::state& state) {
@@ -3981,6 +3983,40 @@ void resolve_constructions(sys::state& state) {
 	}
 }
 
+void update_budget_estimates(sys::state& state, dcon::nation_id n) {
+	state.world.nation_set_estimated_gold_income(n, estimate_gold_income(state, n));
+	state.world.nation_set_estimated_tariff_income(n, estimate_tariff_income(state, n));
+	state.world.nation_set_estimated_social_spending(n, estimate_social_spending(state, n));
+	state.world.nation_set_estimated_education_spending(n, estimate_pop_payouts_by_income_type(state, n, culture::income_type::education));
+	state.world.nation_set_estimated_administration_spending(n, estimate_pop_payouts_by_income_type(state, n, culture::income_type::administration));
+	state.world.nation_set_estimated_military_spending(n, estimate_pop_payouts_by_income_type(state, n, culture::income_type::military));
+	state.world.nation_set_estimated_land_spending(n, estimate_land_spending(state, n));
+	state.world.nation_set_estimated_naval_spending(n, estimate_naval_spending(state, n));
+	state.world.nation_set_estimated_construction_spending(n, estimate_construction_spending(state, n));
+	state.world.nation_set_estimated_stockpile_filling_spending(n, estimate_stockpile_filling_spending(state, n));
+	state.world.nation_set_estimated_overseas_penalty_spending(n, estimate_overseas_penalty_spending(state, n));
+	state.world.nation_set_estimated_diplomatic_balance(n, estimate_diplomatic_balance(state, n));
+}
+
+float estimated_pop_payouts_by_income_type(sys::state& state, dcon::nation_id n, culture::income_type in) {
+	switch(in) {
+	case culture::income_type::education:
+		return state.world.nation_get_estimated_education_spending(n);
+	case culture::income_type::administration:
+		return state.world.nation_get_estimated_administration_spending(n);
+	case culture::income_type::military:
+		return state.world.nation_get_estimated_military_spending(n);
+	default:
+		return estimate_pop_payouts_by_income_type(state, n, in);
+	}
+}
+
+void update_budget_estimates(sys::state& state) {
+	concurrency::parallel_for(uint32_t(0), state.world.nation_size(), [&](uint32_t i) {
+		update_budget_estimates(state, dcon::nation_id{ dcon::nation_id::value_base_t(i) });
+	});
+}
+
 float estimate_daily_income(sys::state& state, dcon::nation_id n) {
 	/* TODO -
 	 * This should return what we think the income will be next day, and as a result wont account for any unprecedented actions
@@ -139,6 +139,12 @@ float estimate_war_subsidies(sys::state& state, dcon::nation_id n);
 
 float estimate_daily_income(sys::state& state, dcon::nation_id n);
 
+// the estimates above, computed for every nation once per day (at the end of daily_update) so that the ui does not recompute
+// them for every widget that displays one; the values for a single nation can be refreshed early after it changes its budget
+void update_budget_estimates(sys::state& state);
+void update_budget_estimates(sys::state& state, dcon::nation_id n);
+float estimated_pop_payouts_by_income_type(sys::state& state, dcon::nation_id n, culture::income_type in); // reads the cached values where there are any
+
 struct construction_status {
 	float progress = 0.0f; // in range [0,1)
 	bool is_under_construction = false;
@@ -16,7 +16,7 @@ int main() {
 		game_state.load_scenario_data(err);
 		if(!err.accumulated_errors.empty())
 			window::emit_error_message(err.accumulated_errors, true);
-		sys::write_scenario_file(game_state, NATIVE("development_test_file.bin"), 0);
+		sys::write_scenario_file(game_state, NATIVE("development_test_file.bin"), 0, false); // reloaded on every run
 	} else {
 		game_state.fill_unsaved_data();
 	}
@@ -4353,7 +4353,7 @@ void execute_notify_start_game(sys::state& state, dcon::nation_id source) {
 	state.selected_armies.clear();
 	state.selected_navies.clear();
 	state.mode = sys::game_mode_type::in_game;
-	state.game_state_updated.store(true, std::memory_order::release);
+	state.mark_ui_updated(ui::update_domain::all);
 }
 
 void notify_start_game(sys::state& state, dcon::nation_id source) {
@@ -4366,7 +4366,7 @@ void notify_start_game(sys::state& state, dcon::nation_id source) {
 
 void execute_notify_stop_game(sys::state& state, dcon::nation_id source) {
 	state.mode = sys::game_mode_type::pick_nation;
-	state.game_state_updated.store(true, std::memory_order::release);
+	state.mark_ui_updated(ui::update_domain::all);
 }
 
 void notify_stop_game(sys::state& state, dcon::nation_id source) {
@@ -5131,7 +5131,10 @@ void execute_pending_commands(sys::state& state) {
 	}
 
 	if(command_executed) {
-		state.game_state_updated.store(true, std::memory_order::release);
+		// budget and construction commands change the local player's estimates, which would otherwise only be refreshed by the next tick
+		if(state.local_player_nation)
+			economy::update_budget_estimates(state, state.local_player_nation);
+		state.mark_ui_updated(ui::update_domain::all);
 	}
 }
 
@@ -1,6 +1,7 @@
 #include "dcon_generated.hpp"
 #include "system_state.hpp"
 #include "serialization.hpp"
+#include "military.hpp"
 #include <random>
 #include <ctime>
 
@@ -99,7 +100,62 @@ mod_identifier extract_mod_information(uint8_t const* ptr_in, uint64_t file_size
 	native_string mod_path;
 	read_mod_path(ptr_in, file_end, mod_path);
 
-	return mod_identifier{ mod_path, h.timestamp, h.count };
+	return mod_identifier{ mod_path, h.timestamp, h.count, h.source_checksum };
+}
+
+namespace {
+
+void hash_directory(blake2b_state& hash_state, simple_fs::directory const& dir) {
+	auto files = simple_fs::list_files(dir, NATIVE(""));
+	std::sort(files.begin(), files.end(), [](simple_fs::unopened_file const& a, simple_fs::unopened_file const& b) {
+		return simple_fs::get_file_name(a) < simple_fs::get_file_name(b);
+	});
+	for(auto& f : files) {
+		auto name = simple_fs::get_file_name(f);
+		blake2b_update(&hash_state, name.data(), name.length() * sizeof(native_char));
+		if(auto of = simple_fs::open_file(f); of) {
+			auto content = simple_fs::view_contents(*of);
+			blake2b_update(&hash_state, &content.file_size, sizeof(content.file_size));
+			blake2b_update(&hash_state, content.data, content.file_size);
+		}
+	}
+
+	auto subdirs = simple_fs::list_subdirectories(dir);
+	std::sort(subdirs.begin(), subdirs.end(), [](simple_fs::directory const& a, simple_fs::directory const& b) {
+		return simple_fs::get_full_name(a) < simple_fs::get_full_name(b);
+	});
+	for(auto& d : subdirs) {
+		auto name = simple_fs::get_full_name(d);
+		blake2b_update(&hash_state, name.data(), name.length() * sizeof(native_char));
+		hash_directory(hash_state, d);
+	}
+}
+
+} // namespace
+
+checksum_key scenario_source_checksum(simple_fs::file_system const& fs) {
+	blake2b_state hash_state;
+	checksum_key result;
+	blake2b_init(&hash_state, sizeof(result));
+
+	// a scenario written in a different format must be rebuilt even when the files are identical
+	uint32_t const version = scenario_file_version;
+	blake2b_update(&hash_state, &version, sizeof(version));
+
+	auto const roots = simple_fs::extract_state(fs);
+	blake2b_update(&hash_state, roots.data(), roots.length() * sizeof(native_char));
+
+	auto root = simple_fs::get_root(fs);
+	native_char const* source_directories[] = {NATIVE("assets"), NATIVE("common"), NATIVE("decisions"), NATIVE("events"),
+			NATIVE("gfx"), NATIVE("history"), NATIVE("interface"), NATIVE("inventions"), NATIVE("localisation"), NATIVE("map"),
+			NATIVE("poptypes"), NATIVE("technologies"), NATIVE("units")};
+	for(auto d : source_directories) {
+		blake2b_update(&hash_state, d, native_string_view(d).length() * sizeof(native_char));
+		hash_directory(hash_state, simple_fs::open_directory(root, d));
+	}
+
+	blake2b_final(&hash_state, &result, sizeof(result));
+	return result;
 }
 
 uint8_t* write_compressed_section(uint8_t* ptr_out, uint8_t const* ptr_in, uint32_t uncompressed_size) {
@@ -114,6 +170,27 @@ uint8_t* write_compressed_section(uint8_t* ptr_out, uint8_t const* ptr_in, uint3
 	return ptr_out + sizeof(uint32_t) * 2 + section_length;
 }
 
+uint8_t* write_uncompressed_section(uint8_t* ptr_out, uint8_t const* ptr_in, uint32_t uncompressed_size) {
+	uint32_t section_length = uncompressed_section_marker;
+
+	memcpy(ptr_out, &section_length, sizeof(uint32_t));
+	memcpy(ptr_out + sizeof(uint32_t), &uncompressed_size, sizeof(uint32_t));
+	memcpy(ptr_out + sizeof(uint32_t) * 2, ptr_in, uncompressed_size);
+
+	return ptr_out + sizeof(uint32_t) * 2 + uncompressed_size;
+}
+
+uint8_t const* skip_section(uint8_t const* ptr_in) {
+	uint32_t section_length = 0;
+	uint32_t decompressed_length = 0;
+	memcpy(&section_length, ptr_in, sizeof(uint32_t));
+	memcpy(&decompressed_length, ptr_in + sizeof(uint32_t), sizeof(uint32_t));
+
+	if(section_length == uncompressed_section_marker)
+		return ptr_in + sizeof(uint32_t) * 2 + decompressed_length;
+	return ptr_in + sizeof(uint32_t) * 2 + section_length;
+}
+
 template<typename T>
 uint8_t const* with_decompressed_section(uint8_t const* ptr_in, T const& function) {
 	uint32_t section_length = 0;
@@ -121,12 +198,16 @@ uint8_t const* with_decompressed_section(uint8_t const* ptr_in, T const& functio
 	memcpy(&section_length, ptr_in, sizeof(uint32_t));
 	memcpy(&decompressed_length, ptr_in + sizeof(uint32_t), sizeof(uint32_t));
 
+	if(section_length == uncompressed_section_marker) {
+		// read straight out of the mapped file: no decompression and no intermediate buffer
+		function(ptr_in + sizeof(uint32_t) * 2, decompressed_length);
+		return ptr_in + sizeof(uint32_t) * 2 + decompressed_length;
+	}
+
 	uint8_t* temp_buffer = new uint8_t[decompressed_length];
-	// TODO: allocate memory for decompression and decompress into it
 
 	ZSTD_decompress(temp_buffer, decompressed_length, ptr_in + sizeof(uint32_t) * 2, section_length);
 
-	// function(ptr_in + sizeof(uint32_t) * 2, decompressed_length);
 	function(temp_buffer, decompressed_length);
 
 	delete[] temp_buffer;
@@ -784,10 +865,16 @@ size_t sizeof_save_section(sys::state& state) {
 	return sz;
 }
 
-void write_scenario_file(sys::state& state, native_string_view name, uint32_t count) {
+void write_scenario_file(sys::state& state, native_string_view name, uint32_t count, bool compress_scenario_section) {
+	write_scenario_file(state, name, count, scenario_source_checksum(state.common_fs), compress_scenario_section);
+}
+
+void write_scenario_file(sys::state& state, native_string_view name, uint32_t count, checksum_key const& source_checksum,
+		bool compress_scenario_section) {
 	scenario_header header;
 	header.count = count;
 	header.timestamp = uint64_t(std::time(nullptr));
+	header.source_checksum = source_checksum;
 
 	size_t scenario_space = sizeof_scenario_section(state);
 	size_t save_space = sizeof_save_section(state);
@@ -798,7 +885,7 @@ void write_scenario_file(sys::state& state, native_string_view name, uint32_t co
 
 	// this is an upper bound, since compacting the data may require less space
 	size_t total_size =
-			sizeof_scenario_header(header) + sizeof_mod_path(simple_fs::extract_state(state.common_fs)) + ZSTD_compressBound(scenario_space) + ZSTD_compressBound(save_space) + sizeof(uint32_t) * 4;
+			sizeof_scenario_header(header) + sizeof_mod_path(simple_fs::extract_state(state.common_fs)) + std::max(ZSTD_compressBound(scenario_space), scenario_space) + ZSTD_compressBound(save_space) + sizeof(uint32_t) * 4;
 
 	uint8_t* temp_buffer = new uint8_t[total_size];
 	uint8_t* buffer_position = temp_buffer;
@@ -815,7 +902,10 @@ void write_scenario_file(sys::state& state, native_string_view name, uint32_t co
 	blake2b(checksum, sizeof(*checksum), temp_scenario_buffer, scenario_space, nullptr, 0);
 	state.scenario_checksum = *checksum;
 
-	buffer_position = write_compressed_section(buffer_position, temp_scenario_buffer, uint32_t(scenario_space));
+	if(compress_scenario_section)
+		buffer_position = write_compressed_section(buffer_position, temp_scenario_buffer, uint32_t(scenario_space));
+	else
+		buffer_position = write_uncompressed_section(buffer_position, temp_scenario_buffer, uint32_t(scenario_space));
 	delete[] temp_scenario_buffer;
 
 	uint8_t* temp_save_buffer = new uint8_t[save_space];
@@ -941,10 +1031,7 @@ bool try_read_scenario_as_save_file(sys::state& state, native_string_view name)
 
 		buffer_pos = load_mod_path(buffer_pos, state);
 
-		buffer_pos = with_decompressed_section(buffer_pos,
-			[&](uint8_t const* ptr_in, uint32_t length) {
-				// DO NOTHING -- this skips over reading the scenario section
-			});
+		buffer_pos = skip_section(buffer_pos); // the scenario section is already loaded
 		buffer_pos = with_decompressed_section(buffer_pos,
 			[&](uint8_t const* ptr_in, uint32_t length) {
 				read_save_section(ptr_in, ptr_in + length, state);
@@ -1035,6 +1122,9 @@ bool try_read_save_file(sys::state& state, native_string_view name) {
 		buffer_pos = with_decompressed_section(buffer_pos,
 				[&](uint8_t const* ptr_in, uint32_t length) { read_save_section(ptr_in, ptr_in + length, state); });
 
+		// no ui element or queued command refers to a regiment or ship yet, so the ids are free to change here
+		military::compact_units(state);
+
 		return true;
 	} else {
 		return false;
@@ -129,13 +129,14 @@ uint8_t const* deserialize(uint8_t const* ptr_in, ankerl::unordered_dense::map<u
 }
 
 constexpr inline uint32_t save_file_version = 32;
-constexpr inline uint32_t scenario_file_version = 103 + save_file_version;
+constexpr inline uint32_t scenario_file_version = 105 + save_file_version;
 
 struct scenario_header {
 	uint32_t version = scenario_file_version;
 	uint32_t count = 0;
 	uint64_t timestamp = 0;
 	checksum_key checksum;
+	checksum_key source_checksum; // hash of the game and mod files the scenario was built from
 };
 
 struct save_header {
@@ -152,6 +153,7 @@ struct mod_identifier {
 	native_string mod_path;
 	uint64_t timestamp = 0;
 	uint32_t count = 0;
+	checksum_key source_checksum;
 };
 
 void read_mod_path(uint8_t const* ptr_in, uint8_t const* lim, native_string& path_out);
@@ -167,8 +169,16 @@ size_t sizeof_scenario_header(scenario_header const& header_in);
 size_t sizeof_save_header(save_header const& header_in);
 
 mod_identifier extract_mod_information(uint8_t const* ptr_in, uint64_t file_size);
+// hashes the scenario file version and the names and contents of every file under the directories that scenario
+// creation reads from; two file systems with the same checksum produce the same scenario, so an existing scenario file can be
+// reused instead of being rebuilt
+checksum_key scenario_source_checksum(simple_fs::file_system const& fs);
 
 uint8_t* write_compressed_section(uint8_t* ptr_out, uint8_t const* ptr_in, uint32_t uncompressed_size);
+// A section whose compressed length is this marker is stored as is, and is read directly out of the memory mapped file
+constexpr inline uint32_t uncompressed_section_marker = 0xFFFFFFFF;
+uint8_t* write_uncompressed_section(uint8_t* ptr_out, uint8_t const* ptr_in, uint32_t uncompressed_size);
+uint8_t const* skip_section(uint8_t const* ptr_in);
 
 // Note: these functions are for read / writing the *uncompressed* data
 uint8_t const* read_scenario_section(uint8_t const* ptr_in, uint8_t const* section_end, sys::state& state);
@@ -178,7 +188,11 @@ uint8_t* write_save_section(uint8_t* ptr_in, sys::state& state);
 size_t sizeof_scenario_section(sys::state& state);
 size_t sizeof_save_section(sys::state& state);
 
-void write_scenario_file(sys::state& state, native_string_view name, uint32_t count);
+// leaving the scenario section uncompressed makes the file several times larger, but loading it skips decompression entirely
+void write_scenario_file(sys::state& state, native_string_view name, uint32_t count, bool compress_scenario_section = true);
+// as above, but records a source checksum that the caller has already computed with scenario_source_checksum
+void write_scenario_file(sys::state& state, native_string_view name, uint32_t count, checksum_key const& source_checksum,
+		bool compress_scenario_section = true);
 bool try_read_scenario_file(sys::state& state, native_string_view name);
 bool try_read_scenario_and_save_file(sys::state& state, native_string_view name);
 bool try_read_scenario_as_save_file(sys::state& state, native_string_view name);
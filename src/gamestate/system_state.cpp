@@ -175,7 +175,7 @@ void state::on_lbutton_up(int32_t x, int32_t y, key_modifiers mod) {
 		drag_selecting = false;
 		selected_armies.clear();
 		selected_navies.clear();
-		game_state_updated.store(true, std::memory_order_release);
+		mark_ui_updated(ui::update_domain::selection);
 	} else {
 		drag_selecting = false;
 		if(x < x_drag_start)
@@ -257,7 +257,7 @@ void state::on_lbutton_up(int32_t x, int32_t y, key_modifiers mod) {
 				sound::play_effect(*this, sound::get_navy_select_sound(*this), user_settings.effects_volume * user_settings.master_volume);
 			}
 		}
-		game_state_updated.store(true, std::memory_order_release);
+		mark_ui_updated(ui::update_domain::selection);
 	}
 }
 void state::on_mouse_move(int32_t x, int32_t y, key_modifiers mod) {
@@ -358,7 +358,7 @@ void state::on_key_down(virtual_key keycode, key_modifiers mod) {
 				} else if(!selected_armies.empty() || !selected_navies.empty()) {
 					selected_armies.clear();
 					selected_navies.clear();
-					game_state_updated.store(true, std::memory_order::release);
+					mark_ui_updated(ui::update_domain::selection);
 				} else {
 					ui::show_main_menu(*this);
 				}
@@ -398,6 +398,7 @@ inline constexpr int32_t tooltip_width = 400;
 void state::render() { // called to render the frame may (and should) delay returning until the frame is rendered, including
 	// waiting for vsync
 	auto game_state_was_updated = game_state_updated.exchange(false, std::memory_order::acq_rel);
+	auto updated_domains = game_state_was_updated ? updated_ui_domains.exchange(0, std::memory_order::acq_rel) : uint32_t(0);
 	auto ownership_update = province_ownership_changed.exchange(false, std::memory_order::acq_rel);
 	if(ownership_update) {
 		if(user_settings.map_label != sys::map_label_mode::none)
@@ -561,6 +562,8 @@ void state::render() { // called to render the frame may (and should) delay retu
 
 
 			ui_state.nation_picker->impl_on_update(*this);
+			if((updated_domains & ~(ui::update_domain::selection | ui::update_domain::messages)) != 0)
+				map_mode::invalidate_map_modes(*this);
 			map_mode::update_map_mode(*this);
 
 
@@ -682,6 +685,7 @@ void state::render() { // called to render the frame may (and should) delay retu
 			}
 		}
 
+		ogl::flush_sprite_batch(*this);
 		map_state.render(*this, x_size, y_size);
 
 		// UI rendering
@@ -875,11 +879,14 @@ void state::render() { // called to render the frame may (and should) delay retu
 				c5 = new_requests.front();
 			}
 			if(had_diplo_msg) {
+				updated_domains |= ui::update_domain::messages;
 				sound::play_effect(*this, sound::get_diplomatic_request_sound(*this), user_settings.interface_volume* user_settings.master_volume);
 			}
 
 			// Log messages
 			auto* c6 = new_messages.front();
+			if(c6)
+				updated_domains |= ui::update_domain::messages;
 			while(c6) {
 				if(c6->about == local_player_nation) {
 					if(user_settings.self_message_settings[int32_t(c6->type)] & message_response::log) {
@@ -1012,15 +1019,21 @@ void state::render() { // called to render the frame may (and should) delay retu
 			ui_state.root->move_child_to_front(ui_state.msg_window);
 		}
 
-		ui_state.root->impl_on_update(*this);
+		static_cast<ui::container_base*>(ui_state.root.get())->impl_on_update(*this, updated_domains);
+		// map mode colors only depend on the game state and the selected province, not on unit selection or messages
+		if((updated_domains & ~(ui::update_domain::selection | ui::update_domain::messages)) != 0)
+			map_mode::invalidate_map_modes(*this);
 		map_mode::update_map_mode(*this);
 		if(ui_state.unit_details_box->is_visible())
 			ui_state.unit_details_box->impl_on_update(*this);
 		ui::close_expired_event_windows(*this);
 
-		ui_state.rgos_root->impl_on_update(*this);
-		ui_state.units_root->impl_on_update(*this);
-		if(ui_state.ctrl_held_down && map_state.get_zoom() >= ui::big_counter_cutoff) {
+		if((updated_domains & ui::update_domain::economy) != 0)
+			ui_state.rgos_root->impl_on_update(*this);
+		if((updated_domains & (ui::update_domain::military | ui::update_domain::diplomacy | ui::update_domain::selection)) != 0)
+			ui_state.units_root->impl_on_update(*this);
+		if(ui_state.ctrl_held_down && map_state.get_zoom() >= ui::big_counter_cutoff &&
+				(updated_domains & (ui::update_domain::simulation | ui::update_domain::selection)) != 0) {
 			ui_state.province_details_root->impl_on_update(*this);
 		}
 
@@ -1054,9 +1067,13 @@ void state::render() { // called to render the frame may (and should) delay retu
 			ui_state.navy_status_window->set_visible(*this, false);
 		}
 
-		if(ui_state.last_tooltip && ui_state.tooltip->is_visible()) {
+		// a visible tooltip is only rebuilt when something it may depend on has changed; trigger and effect explanations in
+		// particular are expensive to regenerate
+		if(ui_state.last_tooltip && ui_state.tooltip->is_visible() &&
+				(updated_domains & ui::effective_update_domains(*this, *ui_state.last_tooltip)) != 0) {
 			auto type = ui_state.last_tooltip->has_tooltip(*this);
 			if(type == ui::tooltip_behavior::variable_tooltip || type == ui::tooltip_behavior::position_sensitive_tooltip) {
+				ui_state.last_tooltip_location = tooltip_probe.relative_location;
 				auto container = text::create_columnar_layout(ui_state.tooltip->internal_layout,
 						text::layout_parameters{ 16, 16, tooltip_width, int16_t(ui_state.root->base_data.size.y - 20), ui_state.tooltip_font, 0,
 								text::alignment::left,
@@ -1076,6 +1093,7 @@ void state::render() { // called to render the frame may (and should) delay retu
 
 	if(ui_state.last_tooltip != tooltip_probe.under_mouse) {
 		ui_state.last_tooltip = tooltip_probe.under_mouse;
+		ui_state.last_tooltip_location = tooltip_probe.relative_location;
 		if(tooltip_probe.under_mouse) {
 			auto type = ui_state.last_tooltip->has_tooltip(*this);
 			if(type != ui::tooltip_behavior::no_tooltip) {
@@ -1099,7 +1117,10 @@ void state::render() { // called to render the frame may (and should) delay retu
 		} else {
 			ui_state.tooltip->set_visible(*this, false);
 		}
-	} else if(ui_state.last_tooltip && ui_state.last_tooltip->has_tooltip(*this) == ui::tooltip_behavior::position_sensitive_tooltip) {
+	} else if(ui_state.last_tooltip && (ui_state.last_tooltip_location.x != tooltip_probe.relative_location.x ||
+																				ui_state.last_tooltip_location.y != tooltip_probe.relative_location.y) &&
+						ui_state.last_tooltip->has_tooltip(*this) == ui::tooltip_behavior::position_sensitive_tooltip) {
+		ui_state.last_tooltip_location = tooltip_probe.relative_location;
 		auto container = text::create_columnar_layout(ui_state.tooltip->internal_layout,
 				text::layout_parameters{ 16, 16, tooltip_width, int16_t(ui_state.root->base_data.size.y - 20), ui_state.tooltip_font, 0,
 						text::alignment::left,
@@ -1161,20 +1182,26 @@ void state::render() { // called to render the frame may (and should) delay retu
 			prov = dcon::province_id{};
 
 		if(prov) {
-			auto container = text::create_columnar_layout(ui_state.tooltip->internal_layout,
-					text::layout_parameters{ 16, 16, tooltip_width, int16_t(ui_state.root->base_data.size.y - 20), ui_state.tooltip_font, 0, text::alignment::left, text::text_color::white, true },
-					20);
+			// the tooltip contents only change with the hovered province and the game state; the position below follows
+			// the camera and is updated every frame
+			if(prov != ui_state.last_map_tooltip_province || game_state_was_updated) {
+				ui_state.last_map_tooltip_province = prov;
+				auto container = text::create_columnar_layout(ui_state.tooltip->internal_layout,
+						text::layout_parameters{ 16, 16, tooltip_width, int16_t(ui_state.root->base_data.size.y - 20), ui_state.tooltip_font, 0, text::alignment::left, text::text_color::white, true },
+						20);
 
-			// Enable this and tooltip will follow the cursor
-			// ui_state.tooltip->base_data.position.x = int16_t(mouse_x_position / user_settings.ui_scale);
-			// ui_state.tooltip->base_data.position.y = int16_t(mouse_y_position / user_settings.ui_scale);
+				// Enable this and tooltip will follow the cursor
+				// ui_state.tooltip->base_data.position.x = int16_t(mouse_x_position / user_settings.ui_scale);
+				// ui_state.tooltip->base_data.position.y = int16_t(mouse_y_position / user_settings.ui_scale);
 
 
-			ui::populate_map_tooltip(*this, container, prov);
+				ui::populate_map_tooltip(*this, container, prov);
 
-			ui_state.tooltip->base_data.size.x = int16_t(container.used_width + 16);
-			ui_state.tooltip->base_data.size.y = int16_t(container.used_height + 16);
-			if(container.used_width > 0) {
+				ui_state.tooltip->base_data.size.x = int16_t(container.used_width + 16);
+				ui_state.tooltip->base_data.size.y = int16_t(container.used_height + 16);
+			}
+			auto used_width = ui_state.tooltip->base_data.size.x - 16;
+			if(used_width > 0) {
 				// This block positions the tooltip somewhat under the province centroid
 
 				auto mid_point = world.province_get_mid_point(prov);
@@ -1186,7 +1213,7 @@ void state::render() { // called to render the frame may (and should) delay retu
 					ui_state.tooltip->set_visible(*this, false);
 				} else {
 					ui_state.tooltip->base_data.position =
-						ui::xy_pair{ int16_t(screen_pos.x - container.used_width / 2 - 8), int16_t(screen_pos.y + 3.5f * map_state.get_zoom()) };
+						ui::xy_pair{ int16_t(screen_pos.x - used_width / 2 - 8), int16_t(screen_pos.y + 3.5f * map_state.get_zoom()) };
 					ui_state.tooltip->set_visible(*this, true);
 				}
 
@@ -1197,8 +1224,12 @@ void state::render() { // called to render the frame may (and should) delay retu
 				ui_state.tooltip->set_visible(*this, false);
 			}
 		} else {
+			ui_state.last_map_tooltip_province = dcon::province_id{};
 			ui_state.tooltip->set_visible(*this, false);
 		}
+	} else {
+		// a ui tooltip may have replaced the contents of the tooltip window
+		ui_state.last_map_tooltip_province = dcon::province_id{};
 	}
 
 	glClearColor(0.5f, 0.5f, 0.5f, 1.0f);
@@ -1220,6 +1251,7 @@ void state::render() { // called to render the frame may (and should) delay retu
 		}
 	}
 
+	ogl::flush_sprite_batch(*this);
 	map_state.render(*this, x_size, y_size);
 
 	// UI rendering
@@ -1552,23 +1584,10 @@ dcon::text_key state::add_to_pool_lowercase(std::string_view new_text) {
 	return res;
 }
 dcon::text_key state::add_to_pool(std::string const& new_text) {
-	auto start = text_data.size();
-	auto size = new_text.length();
-	if(size == 0)
-		return dcon::text_key();
-	text_data.resize(start + size + 1, char(0));
-	std::copy_n(new_text.c_str(), size + 1, text_data.data() + start);
-	return dcon::text_key(uint32_t(start));
+	return text::add_to_pool(text_data, std::string_view(new_text));
 }
 dcon::text_key state::add_to_pool(std::string_view new_text) {
-	auto start = text_data.size();
-	auto length = new_text.length();
-	if(length == 0)
-		return dcon::text_key();
-	text_data.resize(start + length + 1, char(0));
-	std::copy_n(new_text.data(), length, text_data.data() + start);
-	text_data.back() = 0;
-	return dcon::text_key(uint32_t(start));
+	return text::add_to_pool(text_data, new_text);
 }
 
 dcon::text_key state::add_unique_to_pool(std::string const& new_text) {
@@ -1821,6 +1840,33 @@ void state::open_diplomacy(dcon::nation_id target) {
 	}
 }
 
+// Opens the files of a directory listing and brings their contents into memory in parallel, a batch at a time, while
+// handing them to func serially and in listing order. Parsing a file writes into the game state, so it has to stay
+// serial (and ordered, to keep scenarios deterministic); only the disk reads, which dominate for the thousands of
+// small history files of large mods, are overlapped. The batches bound the number of files held open at once.
+template<typename F>
+void for_each_file_prefetched(std::vector<simple_fs::unopened_file> const& files, F&& func) {
+	constexpr uint32_t batch_size = 128;
+	std::vector<std::optional<simple_fs::file>> opened(batch_size);
+	for(size_t start = 0; start < files.size(); start += batch_size) {
+		auto count = uint32_t(std::min(size_t(batch_size), files.size() - start));
+		concurrency::parallel_for(uint32_t(0), count, [&](uint32_t i) {
+			opened[i] = simple_fs::open_file(files[start + i]);
+			if(opened[i]) {
+				// files are memory mapped: touch each page so that the fault is taken here rather than during parsing
+				auto content = simple_fs::view_contents(*opened[i]);
+				volatile char touched = 0;
+				for(uint32_t j = 0; j < content.file_size; j += 4096)
+					touched = content.data[j];
+			}
+		});
+		for(uint32_t i = 0; i < count; ++i) {
+			func(files[start + i], opened[i]);
+			opened[i].reset();
+		}
+	}
+}
+
 void state::load_scenario_data(parsers::error_handler& err) {
 
 	parsers::scenario_building_context context(*this);
@@ -2364,7 +2410,8 @@ void state::load_scenario_data(parsers::error_handler& err) {
 	{
 		auto prov_history = open_directory(history, NATIVE("provinces"));
 		for(auto subdir : list_subdirectories(prov_history)) {
-			for(auto prov_file : list_files(subdir, NATIVE(".txt"))) {
+			for_each_file_prefetched(list_files(subdir, NATIVE(".txt")), [&](simple_fs::unopened_file const& prov_file,
+					std::optional<simple_fs::file>& opened_file) {
 				auto file_name = simple_fs::native_to_utf8(get_full_name(prov_file));
 				auto name_begin = file_name.c_str();
 				auto name_end = name_begin + file_name.length();
@@ -2383,7 +2430,6 @@ void state::load_scenario_data(parsers::error_handler& err) {
 				err.file_name = file_name;
 				auto province_id = parsers::parse_int(std::string_view(value_start, name_end - value_start), 0, err);
 				if(province_id > 0 && uint32_t(province_id) < context.original_id_to_prov_id_map.size()) {
-					auto opened_file = open_file(prov_file);
 					if(opened_file) {
 						auto pid = context.original_id_to_prov_id_map[province_id];
 						parsers::province_file_context pf_context{context, pid};
@@ -2392,7 +2438,7 @@ void state::load_scenario_data(parsers::error_handler& err) {
 						parsers::parse_province_history_file(gen, err, pf_context);
 					}
 				}
-			}
+			});
 		}
 	}
 
@@ -2406,15 +2452,15 @@ void state::load_scenario_data(parsers::error_handler& err) {
 				std::to_string(startdate.year) + "." + std::to_string(startdate.month) + "." + std::to_string(startdate.day);
 		auto date_directory = open_directory(pop_history, simple_fs::utf8_to_native(start_dir_name));
 
-		for(auto pop_file : list_files(date_directory, NATIVE(".txt"))) {
-			auto opened_file = open_file(pop_file);
+		for_each_file_prefetched(list_files(date_directory, NATIVE(".txt")), [&](simple_fs::unopened_file const&,
+				std::optional<simple_fs::file>& opened_file) {
 			if(opened_file) {
 				err.file_name = simple_fs::native_to_utf8(get_full_name(*opened_file));
 				auto content = view_contents(*opened_file);
 				parsers::token_generator gen(content.data, content.data + content.file_size);
 				parsers::parse_pop_history_file(gen, err, context);
 			}
-		}
+		});
 	}
 	// load poptype definitions
 	{
@@ -2588,22 +2634,22 @@ void state::load_scenario_data(parsers::error_handler& err) {
 	// load decisions
 	{
 		auto decisions = open_directory(root, NATIVE("decisions"));
-		for(auto decision_file : list_files(decisions, NATIVE(".txt"))) {
-			auto opened_file = open_file(decision_file);
+		for_each_file_prefetched(list_files(decisions, NATIVE(".txt")), [&](simple_fs::unopened_file const&,
+				std::optional<simple_fs::file>& opened_file) {
 			if(opened_file) {
 				err.file_name = simple_fs::native_to_utf8(get_full_name(*opened_file));
 				auto content = view_contents(*opened_file);
 				parsers::token_generator gen(content.data, content.data + content.file_size);
 				parsers::parse_decision_file(gen, err, context);
 			}
-		}
+		});
 	}
 	// load events
 	{
 		auto events = open_directory(root, NATIVE("events"));
 		std::vector<simple_fs::file> held_open_files;
-		for(auto event_file : list_files(events, NATIVE(".txt"))) {
-			auto opened_file = open_file(event_file);
+		for_each_file_prefetched(list_files(events, NATIVE(".txt")), [&](simple_fs::unopened_file const&,
+				std::optional<simple_fs::file>& opened_file) {
 			if(opened_file) {
 				err.file_name = simple_fs::native_to_utf8(get_full_name(*opened_file));
 				auto content = view_contents(*opened_file);
@@ -2611,7 +2657,7 @@ void state::load_scenario_data(parsers::error_handler& err) {
 				parsers::parse_event_file(gen, err, context);
 				held_open_files.emplace_back(std::move(*opened_file));
 			}
-		}
+		});
 		err.file_name = "pending events";
 		parsers::commit_pending_events(err, context);
 	}
@@ -2658,15 +2704,15 @@ void state::load_scenario_data(parsers::error_handler& err) {
 	// parse diplomacy history
 	{
 		auto diplomacy_dir = open_directory(history, NATIVE("diplomacy"));
-		for(auto dip_file : list_files(diplomacy_dir, NATIVE(".txt"))) {
-			auto opened_file = open_file(dip_file);
+		for_each_file_prefetched(list_files(diplomacy_dir, NATIVE(".txt")), [&](simple_fs::unopened_file const&,
+				std::optional<simple_fs::file>& opened_file) {
 			if(opened_file) {
 				auto content = view_contents(*opened_file);
 				err.file_name = simple_fs::native_to_utf8(simple_fs::get_full_name(*opened_file));
 				parsers::token_generator gen(content.data, content.data + content.file_size);
 				parsers::parse_diplomacy_file(gen, err, context);
 			}
-		}
+		});
 	}
 
 	// !!!! yes, I know
@@ -2677,7 +2723,8 @@ void state::load_scenario_data(parsers::error_handler& err) {
 	// load country history
 	{
 		auto country_dir = open_directory(history, NATIVE("countries"));
-		for(auto country_file : list_files(country_dir, NATIVE(".txt"))) {
+		for_each_file_prefetched(list_files(country_dir, NATIVE(".txt")), [&](simple_fs::unopened_file const& country_file,
+				std::optional<simple_fs::file>& opened_file) {
 			auto file_name = get_full_name(country_file);
 
 			auto last = file_name.c_str() + file_name.length();
@@ -2703,7 +2750,6 @@ void state::load_scenario_data(parsers::error_handler& err) {
 
 					parsers::country_history_context new_context{context, it->second, holder, pending_decisions};
 
-					auto opened_file = open_file(country_file);
 					if(opened_file) {
 						err.file_name = utf8name;
 						auto content = view_contents(*opened_file);
@@ -2716,14 +2762,14 @@ void state::load_scenario_data(parsers::error_handler& err) {
 							"invalid tag " + utf8name.substr(0, 3) + " encountered while scanning country history files\n";
 				}
 			}
-		}
+		});
 	}
 
 	// load war history
 	{
 		auto country_dir = open_directory(history, NATIVE("wars"));
-		for(auto war_file : list_files(country_dir, NATIVE(".txt"))) {
-			auto opened_file = open_file(war_file);
+		for_each_file_prefetched(list_files(country_dir, NATIVE(".txt")), [&](simple_fs::unopened_file const&,
+				std::optional<simple_fs::file>& opened_file) {
 			if(opened_file) {
 				parsers::war_history_context new_context{context};
 
@@ -2732,7 +2778,7 @@ void state::load_scenario_data(parsers::error_handler& err) {
 				parsers::token_generator gen(content.data, content.data + content.file_size);
 				parsers::parse_war_history_file(gen, err, new_context);
 			}
-		}
+		});
 	}
 
 	// misc touch ups
@@ -3155,6 +3201,7 @@ void state::fill_unsaved_data() { // reconstructs derived values that are not di
 	rebel::update_movement_values(*this);
 
 	economy::regenerate_unsaved_values(*this);
+	economy::update_budget_estimates(*this);
 
 	military::regenerate_land_unit_average(*this);
 	military::regenerate_ship_scores(*this);
@@ -3280,7 +3327,7 @@ void state::fill_unsaved_data() { // reconstructs derived values that are not di
 
 #endif // ! NDEBUG
 
-	game_state_updated.store(true, std::memory_order::release);
+	mark_ui_updated(ui::update_domain::all);
 }
 
 void state::single_game_tick() {
@@ -3293,12 +3340,15 @@ void state::single_game_tick() {
 
 	if(!is_playable_date(current_date, start_date, end_date)) {
 		mode = sys::game_mode_type::end_screen;
-		game_state_updated.store(true, std::memory_order::release);
+		mark_ui_updated(ui::update_domain::all);
 		return;
 	}
 
 	auto ymd_date = current_date.to_ymd(start_date);
 
+	// every subsystem that runs below adds the ui domains it can change
+	uint32_t changed_domains = ui::update_domain::date;
+
 	diplomatic_message::update_pending(*this);
 
 	auto month_start = sys::year_month_day{ ymd_date.year, ymd_date.month, uint16_t(1) };
@@ -3475,6 +3525,7 @@ void state::single_game_tick() {
 
 	// basic repopulation of demographics derived values
 	demographics::regenerate_from_pop_data(*this);
+	changed_domains |= ui::update_domain::pops;
 
 	// values updates pass 1 (mostly trivial things, can be done in parallel)
 	concurrency::parallel_for(0, 18, [&](int32_t index) {
@@ -3536,6 +3587,9 @@ void state::single_game_tick() {
 				break;
 		}
 	});
+	// research points and party loyalty also accumulate in this pass, but the windows that show only them wait for the next
+	// technology or politics change
+	changed_domains |= ui::update_domain::economy | ui::update_domain::military | ui::update_domain::diplomacy;
 
 	economy::daily_update(*this);
 
@@ -3548,7 +3602,8 @@ void state::single_game_tick() {
 
 	event::update_events(*this);
 
-	culture::update_research(*this, uint32_t(ymd_date.year));
+	if(culture::update_research(*this, uint32_t(ymd_date.year)))
+		changed_domains |= ui::update_domain::technology;
 
 	nations::update_military_scores(*this); // depends on ship score, land unit average
 	nations::update_rankings(*this);				// depends on industrial score, military scores
@@ -3560,6 +3615,9 @@ void state::single_game_tick() {
 
 	nations::update_crisis(*this);
 	politics::update_elections(*this);
+	if(local_player_nation && (politics::is_election_ongoing(*this, local_player_nation) ||
+		world.nation_get_election_ends(local_player_nation) == current_date))
+		changed_domains |= ui::update_domain::politics;
 
 	//
 	if(current_date.value % 4 == 0) {
@@ -3571,106 +3629,136 @@ void state::single_game_tick() {
 		case 1:
 			nations::update_monthly_points(*this);
 			economy::prune_factories(*this);
+			changed_domains |= ui::update_domain::economy | ui::update_domain::military | ui::update_domain::diplomacy;
 			break;
 		case 2:
 			province::update_blockaded_cache(*this);
 			sys::update_modifier_effects(*this);
+			changed_domains |= ui::update_domain::simulation; // modifiers feed into nearly every displayed value
 			break;
 		case 3:
 			military::monthly_leaders_update(*this);
 			ai::add_gw_goals(*this);
+			changed_domains |= ui::update_domain::military | ui::update_domain::diplomacy;
 			break;
 		case 4:
 			military::reinforce_regiments(*this);
 			ai::make_defense(*this);
+			changed_domains |= ui::update_domain::military;
 			break;
 		case 5:
 			rebel::update_movements(*this);
 			rebel::update_factions(*this);
+			changed_domains |= ui::update_domain::pops;
 			break;
 		case 6:
 			ai::form_alliances(*this);
 			ai::make_attacks(*this);
+			changed_domains |= ui::update_domain::diplomacy | ui::update_domain::military;
 			break;
 		case 7:
 			ai::update_ai_general_status(*this);
 			break;
 		case 8:
 			military::apply_attrition(*this);
+			changed_domains |= ui::update_domain::military;
 			break;
 		case 9:
 			military::repair_ships(*this);
+			changed_domains |= ui::update_domain::military;
 			break;
 		case 10:
 			province::update_crimes(*this);
+			changed_domains |= ui::update_domain::pops;
 			break;
 		case 11:
 			province::update_nationalism(*this);
+			changed_domains |= ui::update_domain::pops;
 			break;
 		case 12:
 			ai::update_ai_research(*this);
+			changed_domains |= ui::update_domain::technology;
 			break;
 		case 13:
 			ai::perform_influence_actions(*this);
+			changed_domains |= ui::update_domain::diplomacy;
 			break;
 		case 14:
 			ai::update_focuses(*this);
+			changed_domains |= ui::update_domain::economy;
 			break;
 		case 15:
 			culture::discover_inventions(*this);
+			changed_domains |= ui::update_domain::technology;
 			break;
 		case 16:
 			ai::take_ai_decisions(*this);
+			changed_domains |= ui::update_domain::politics;
 			break;
 		case 17:
 			ai::build_ships(*this);
 			ai::update_land_constructions(*this);
+			changed_domains |= ui::update_domain::military;
 			break;
 		case 18:
 			ai::update_ai_econ_construction(*this);
+			changed_domains |= ui::update_domain::economy;
 			break;
 		case 19:
 			ai::update_budget(*this);
+			changed_domains |= ui::update_domain::economy;
 			break;
 		case 20:
 			nations::monthly_flashpoint_update(*this);
 			ai::make_defense(*this);
+			changed_domains |= ui::update_domain::diplomacy | ui::update_domain::military;
 			break;
 		case 21:
 			ai::update_ai_colony_starting(*this);
+			changed_domains |= ui::update_domain::diplomacy;
 			break;
 		case 22:
 			ai::take_reforms(*this);
+			changed_domains |= ui::update_domain::politics;
 			break;
 		case 23:
 			ai::civilize(*this);
 			ai::make_war_decs(*this);
+			changed_domains |= ui::update_domain::politics | ui::update_domain::diplomacy;
 			break;
 		case 24:
 			rebel::execute_rebel_victories(*this);
 			ai::make_attacks(*this);
+			changed_domains |= ui::update_domain::pops | ui::update_domain::politics | ui::update_domain::military;
 			break;
 		case 25:
 			rebel::execute_province_defections(*this);
+			changed_domains |= ui::update_domain::pops | ui::update_domain::diplomacy;
 			break;
 		case 26:
 			ai::make_peace_offers(*this);
+			changed_domains |= ui::update_domain::diplomacy;
 			break;
 		case 27:
 			ai::update_crisis_leaders(*this);
+			changed_domains |= ui::update_domain::diplomacy;
 			break;
 		case 28:
 			rebel::rebel_risings_check(*this);
+			changed_domains |= ui::update_domain::pops | ui::update_domain::military;
 			break;
 		case 29:
 			ai::update_war_intervention(*this);
+			changed_domains |= ui::update_domain::diplomacy;
 			break;
 		case 30:
 			ai::update_ships(*this);
+			changed_domains |= ui::update_domain::military;
 			break;
 		case 31:
 			ai::update_cb_fabrication(*this);
 			ai::update_ai_ruling_party(*this);
+			changed_domains |= ui::update_domain::diplomacy | ui::update_domain::politics;
 			break;
 		default:
 			break;
@@ -3681,15 +3769,14 @@ void state::single_game_tick() {
 	if(ymd_date.day == 1) {
 		if(ymd_date.month == 1) {
 			// yearly update : redo the upper house
-			for(auto n : world.in_nation) {
-				if(n.get_owned_province_count() != 0)
-					politics::recalculate_upper_house(*this, n);
-			}
+			politics::update_upper_houses(*this);
 
 			ai::update_influence_priorities(*this);
+			changed_domains |= ui::update_domain::politics | ui::update_domain::diplomacy;
 		}
 		if(ymd_date.month == 2) {
 			ai::upgrade_colonies(*this);
+			changed_domains |= ui::update_domain::diplomacy;
 		}
 		if(ymd_date.month == 3 && !national_definitions.on_quarterly_pulse.empty()) {
 			for(auto n : world.in_nation) {
@@ -3697,12 +3784,15 @@ void state::single_game_tick() {
 					event::fire_fixed_event(*this, national_definitions.on_quarterly_pulse, trigger::to_generic(n.id), event::slot_type::nation, n.id, -1, event::slot_type::none);
 				}
 			}
+			changed_domains |= ui::update_domain::simulation;
 		}
 		if(ymd_date.month == 4 && ymd_date.year % 2 == 0) { // the purge
 			demographics::remove_small_pops(*this);
+			changed_domains |= ui::update_domain::pops;
 		}
 		if(ymd_date.month == 5) {
 			ai::prune_alliances(*this);
+			changed_domains |= ui::update_domain::diplomacy;
 		}
 		if(ymd_date.month == 6 && !national_definitions.on_quarterly_pulse.empty()) {
 			for(auto n : world.in_nation) {
@@ -3710,9 +3800,11 @@ void state::single_game_tick() {
 					event::fire_fixed_event(*this, national_definitions.on_quarterly_pulse, trigger::to_generic(n.id), event::slot_type::nation, n.id, -1, event::slot_type::none);
 				}
 			}
+			changed_domains |= ui::update_domain::simulation;
 		}
 		if(ymd_date.month == 7) {
 			ai::update_influence_priorities(*this);
+			changed_domains |= ui::update_domain::diplomacy;
 		}
 		if(ymd_date.month == 9 && !national_definitions.on_quarterly_pulse.empty()) {
 			for(auto n : world.in_nation) {
@@ -3720,6 +3812,7 @@ void state::single_game_tick() {
 					event::fire_fixed_event(*this, national_definitions.on_quarterly_pulse, trigger::to_generic(n.id), event::slot_type::nation, n.id, -1, event::slot_type::none);
 				}
 			}
+			changed_domains |= ui::update_domain::simulation;
 		}
 		if(ymd_date.month == 10 && !national_definitions.on_yearly_pulse.empty()) {
 			for(auto n : world.in_nation) {
@@ -3727,9 +3820,11 @@ void state::single_game_tick() {
 					event::fire_fixed_event(*this, national_definitions.on_yearly_pulse, trigger::to_generic(n.id), event::slot_type::nation, n.id, -1, event::slot_type::none);
 				}
 			}
+			changed_domains |= ui::update_domain::simulation;
 		}
 		if(ymd_date.month == 11) {
 			ai::prune_alliances(*this);
+			changed_domains |= ui::update_domain::diplomacy;
 		}
 		if(ymd_date.month == 12 && !national_definitions.on_quarterly_pulse.empty()) {
 			for(auto n : world.in_nation) {
@@ -3737,6 +3832,7 @@ void state::single_game_tick() {
 					event::fire_fixed_event(*this, national_definitions.on_quarterly_pulse, trigger::to_generic(n.id), event::slot_type::nation, n.id, -1, event::slot_type::none);
 				}
 			}
+			changed_domains |= ui::update_domain::simulation;
 		}
 	}
 
@@ -3762,7 +3858,7 @@ void state::single_game_tick() {
 
 	ui_date = current_date;
 
-	game_state_updated.store(true, std::memory_order::release);
+	mark_ui_updated(changed_domains);
 
 	switch(user_settings.autosaves) {
 		case autosave_frequency::none:
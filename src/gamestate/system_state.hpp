@@ -432,6 +432,7 @@ struct alignas(64) state {
 	tagged_vector<text::text_sequence, dcon::text_sequence_id> text_sequences;
 	ankerl::unordered_dense::map<dcon::text_key, dcon::text_sequence_id, text::vector_backed_hash, text::vector_backed_eq>
 			key_to_text_sequence;
+	text::layout_cache layout_cache; // ui thread only
 
 	bool adjacency_data_out_of_date = true;
 	bool national_cached_values_out_of_date = false;
@@ -526,6 +527,7 @@ struct alignas(64) state {
 
 	// synchronization data (between main update logic and ui thread)
 	std::atomic<bool> game_state_updated = false;                    // game state -> ui signal
+	std::atomic<uint32_t> updated_ui_domains = 0;                    // game state -> ui signal: ui::update_domain flags
 	std::atomic<bool> province_ownership_changed = true;                    // game state -> ui signal
 	std::atomic<bool> save_list_updated = false;                     // game state -> ui signal
 	std::atomic<bool> quit_signaled = false;                         // ui -> game state signal
@@ -636,6 +638,10 @@ struct alignas(64) state {
 
 	void open_diplomacy(dcon::nation_id target); // Open the diplomacy window with target selected
 
+	void mark_ui_updated(uint32_t domains) { // publishes the domains before raising game_state_updated
+		updated_ui_domains.fetch_or(domains, std::memory_order_release);
+		game_state_updated.store(true, std::memory_order_release);
+	}
 	bool is_selected(dcon::army_id a) {
 		return std::find(selected_armies.begin(), selected_armies.end(), a) != selected_armies.end();
 	}
@@ -645,13 +651,13 @@ struct alignas(64) state {
 	void select(dcon::army_id a) {
 		if(!is_selected(a)) {
 			selected_armies.push_back(a);
-			game_state_updated.store(true, std::memory_order_release);
+			mark_ui_updated(ui::update_domain::selection);
 		}
 	}
 	void select(dcon::navy_id a) {
 		if(!is_selected(a)) {
 			selected_navies.push_back(a);
-			game_state_updated.store(true, std::memory_order_release);
+			mark_ui_updated(ui::update_domain::selection);
 		}
 	}
 	void deselect(dcon::army_id a) {
@@ -659,7 +665,7 @@ struct alignas(64) state {
 			if(selected_armies[i] == a) {
 				selected_armies[i] = selected_armies.back();
 				selected_armies.pop_back();
-				game_state_updated.store(true, std::memory_order_release);
+				mark_ui_updated(ui::update_domain::selection);
 				return;
 			}
 		}
@@ -669,7 +675,7 @@ struct alignas(64) state {
 			if(selected_navies[i] == a) {
 				selected_navies[i] = selected_navies.back();
 				selected_navies.pop_back();
-				game_state_updated.store(true, std::memory_order_release);
+				mark_ui_updated(ui::update_domain::selection);
 				return;
 			}
 		}
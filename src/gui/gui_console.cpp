@@ -589,10 +589,10 @@ void ui::console_edit::edit_box_enter(sys::state& state, std::string_view s) noe
 			if(bool(nid)) {
 				command::c_switch_nation(state, state.local_player_nation, nid);
 				log_to_console(state, parent, "Switching to @" + std::string(tag) + " \xA7Y" + std::string(tag) + "\xA7W");
-				state.game_state_updated.store(true, std::memory_order::release);
+				state.mark_ui_updated(ui::update_domain::all);
 			}
 		}
-		state.game_state_updated.store(true, std::memory_order::release);
+		state.mark_ui_updated(ui::update_domain::all);
 	} break;
 	case command_info::type::help:
 	{
@@ -57,6 +57,9 @@ public:
 		return tooltip_behavior::no_tooltip;
 	}
 	virtual void update_tooltip(sys::state& state, int32_t x, int32_t y, text::columnar_layout& contents) noexcept { }
+	virtual uint32_t update_domains(sys::state& state) noexcept { // which update_domain flags on_update depends on
+		return update_domain::all;
+	}
 
 	// these message handlers can be overridden by basically anyone
 	//        - generally *should not* be called directly
@@ -63,6 +63,14 @@ void container_base::impl_on_update(sys::state& state) noexcept {
 		}
 	}
 }
+void container_base::impl_on_update(sys::state& state, uint32_t changed_domains) noexcept {
+	on_update(state);
+	for(auto& c : children) {
+		if(c->is_visible() && (c->update_domains(state) & changed_domains) != 0) {
+			c->impl_on_update(state);
+		}
+	}
+}
 void container_base::impl_on_reset_text(sys::state& state) noexcept {
 	for(auto& c : children) {
 		c->impl_on_reset_text(state);
@@ -47,6 +47,7 @@ public:
 	mouse_probe impl_probe_mouse(sys::state& state, int32_t x, int32_t y, mouse_probe_type type) noexcept override;
 	message_result impl_on_key_down(sys::state& state, sys::virtual_key key, sys::key_modifiers mods) noexcept final;
 	void impl_on_update(sys::state& state) noexcept override;
+	void impl_on_update(sys::state& state, uint32_t changed_domains) noexcept; // updates only children depending on the changed domains
 	message_result impl_set(sys::state& state, Cyto::Any& payload) noexcept final;
 	void impl_render(sys::state& state, int32_t x, int32_t y) noexcept override;
 	void impl_on_reset_text(sys::state& state) noexcept override;
@@ -771,6 +772,80 @@ public:
 	}
 };
 
+// Keeps the contents of a long list sorted from one update to the next. The sort key of each row is computed once per
+// update instead of once per comparison, and rows start from the order they had after the previous update, with new rows
+// appended. An insertion sort then only moves rows whose key changed relative to their neighbours, so refreshing a list
+// in which few keys changed is close to linear. If too many rows have to move (a new sort order, for example) it falls
+// back to a full stable sort. Rows are identified by the index of their dcon id.
+template<class RowConT, class KeyT = float>
+class sorted_row_model {
+	struct keyed_row {
+		KeyT key;
+		RowConT row;
+	};
+	std::vector<keyed_row> keyed_rows;
+	std::vector<int32_t> previous_slots;
+	std::vector<int32_t> fresh_rows;
+	std::vector<int32_t> last_position; // by row index, -1 if the row was not in the list
+	std::vector<RowConT> last_rows;
+
+public:
+	void reset() {
+		for(auto r : last_rows)
+			last_position[r.index()] = -1;
+		last_rows.clear();
+	}
+
+	// sorts rows by ascending key; rows with equal keys keep their previous relative order
+	template<typename F>
+	void sort(std::vector<RowConT>& rows, F&& key_of) {
+		previous_slots.assign(last_rows.size(), -1);
+		fresh_rows.clear();
+		for(int32_t i = 0; i < int32_t(rows.size()); ++i) {
+			auto index = size_t(rows[i].index());
+			if(index < last_position.size() && last_position[index] >= 0)
+				previous_slots[last_position[index]] = i;
+			else
+				fresh_rows.push_back(i);
+		}
+		keyed_rows.clear();
+		for(auto i : previous_slots) {
+			if(i >= 0)
+				keyed_rows.push_back(keyed_row{key_of(rows[i]), rows[i]});
+		}
+		for(auto i : fresh_rows)
+			keyed_rows.push_back(keyed_row{key_of(rows[i]), rows[i]});
+
+		size_t moves = 0;
+		size_t const move_limit = keyed_rows.size() * 8 + 64;
+		for(size_t i = 1; i < keyed_rows.size(); ++i) {
+			if(!(keyed_rows[i].key < keyed_rows[i - 1].key))
+				continue;
+			auto moving = std::move(keyed_rows[i]);
+			size_t j = i;
+			for(; j > 0 && moving.key < keyed_rows[j - 1].key; --j) {
+				keyed_rows[j] = std::move(keyed_rows[j - 1]);
+			}
+			keyed_rows[j] = std::move(moving);
+			moves += i - j;
+			if(moves > move_limit) {
+				std::stable_sort(keyed_rows.begin(), keyed_rows.end(), [](keyed_row const& a, keyed_row const& b) { return a.key < b.key; });
+				break;
+			}
+		}
+
+		reset();
+		for(size_t i = 0; i < keyed_rows.size(); ++i) {
+			rows[i] = keyed_rows[i].row;
+			auto index = size_t(rows[i].index());
+			if(index >= last_position.size())
+				last_position.resize(index + 1, -1);
+			last_position[index] = int32_t(i);
+		}
+		last_rows = rows;
+	}
+};
+
 template<class RowWinT, class RowConT>
 class standard_listbox_scrollbar : public autoscaling_scrollbar {
 public:
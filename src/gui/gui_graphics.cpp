@@ -230,6 +230,13 @@ xy_pair get_absolute_location(element_base const& node) {
 	}
 }
 
+uint32_t effective_update_domains(sys::state& state, element_base& node) {
+	auto d = node.update_domains(state);
+	if(d == update_domain::all && node.parent)
+		return effective_update_domains(state, *node.parent);
+	return d;
+}
+
 int32_t ui_width(sys::state const& state) {
 	return int32_t(state.x_size / state.user_settings.ui_scale);
 }
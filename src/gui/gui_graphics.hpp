@@ -321,10 +321,31 @@ enum class message_result { unseen, seen, consumed };
 enum class focus_result { ignored, accepted };
 enum class tooltip_behavior { tooltip, variable_tooltip, position_sensitive_tooltip, no_tooltip };
 
+// coarse kinds of state that a change can touch; the game state publishes which of these have changed and, during the
+// per frame refresh, only top level windows that depend on one of them have their on_update functions run
+namespace update_domain {
+
+inline constexpr uint32_t economy = 0x00000001;    // budget, treasury, markets, factories and rgos
+inline constexpr uint32_t pops = 0x00000002;       // pops, demographics, movements and rebels
+inline constexpr uint32_t military = 0x00000004;   // units, leaders, battles and sieges
+inline constexpr uint32_t diplomacy = 0x00000008;  // wars, relations, influence, casus belli and crises
+inline constexpr uint32_t politics = 0x00000010;   // government, parties, reforms, elections and decisions
+inline constexpr uint32_t technology = 0x00000020; // research and inventions
+inline constexpr uint32_t date = 0x00000040;
+inline constexpr uint32_t selection = 0x00000100;  // selected armies and navies
+inline constexpr uint32_t messages = 0x00000200;   // notifications and diplomatic requests delivered to the ui
+
+inline constexpr uint32_t simulation = economy | pops | military | diplomacy | politics | technology | date;
+inline constexpr uint32_t all = 0xFFFFFFFF;
+
+} // namespace update_domain
+
 class element_base;
 
 xy_pair child_relative_location(element_base const& parent, element_base const& child);
 xy_pair get_absolute_location(element_base const& node);
+// the update domains declared by the nearest ancestor (or the element itself) that declares any
+uint32_t effective_update_domains(sys::state& state, element_base& node);
 
 using ui_hook_fn = std::unique_ptr<element_base> (*)(sys::state&, dcon::gui_def_id);
 
@@ -365,6 +386,8 @@ struct state {
 	element_base* drag_target = nullptr;
 	element_base* edit_target = nullptr;
 	element_base* last_tooltip = nullptr;
+	xy_pair last_tooltip_location = xy_pair{ 0, 0 }; // mouse location, relative to last_tooltip, the tooltip was built for
+	dcon::province_id last_map_tooltip_province; // province the tooltip window currently holds the map tooltip of
 	element_base* mouse_sensitive_target = nullptr;
 	xy_pair target_ul_bounds = xy_pair{ 0, 0 };
 	xy_pair target_lr_bounds = xy_pair{ 0, 0 };
@@ -195,7 +195,7 @@ public:
 			for(const auto n : players)
 				state.world.nation_set_is_player_controlled(n, true);
 		}
-		state.game_state_updated.store(true, std::memory_order_release);
+		state.mark_ui_updated(update_domain::all);
 	}
 	void on_update(sys::state& state) noexcept override {
 		save_item* i = retrieve< save_item*>(state, parent);
@@ -1933,6 +1933,10 @@ public:
 	}
 
 	friend class province_national_focus_button;
+
+	uint32_t update_domains(sys::state& state) noexcept override {
+		return update_domain::economy | update_domain::pops | update_domain::military | update_domain::diplomacy | update_domain::politics;
+	}
 };
 
 void province_national_focus_button::button_action(sys::state& state) noexcept {
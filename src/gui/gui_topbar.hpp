@@ -392,15 +392,15 @@ public:
 		auto total_income = economy::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::poor);
 		total_income += economy::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::middle);
 		total_income += economy::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::rich);
-		total_income += economy::estimate_gold_income(state, nation_id);
-
-		auto total_expense = economy::estimate_construction_spending(state, nation_id);
-		total_expense += economy::estimate_land_spending(state, nation_id);
-		total_expense += economy::estimate_naval_spending(state, nation_id);
-		total_expense += economy::estimate_social_spending(state, nation_id);
-		total_expense += economy::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::education);
-		total_expense += economy::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::administration);
-		total_expense += economy::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::military);
+		total_income += state.world.nation_get_estimated_gold_income(nation_id);
+
+		auto total_expense = state.world.nation_get_estimated_construction_spending(nation_id);
+		total_expense += state.world.nation_get_estimated_land_spending(nation_id);
+		total_expense += state.world.nation_get_estimated_naval_spending(nation_id);
+		total_expense += state.world.nation_get_estimated_social_spending(nation_id);
+		total_expense += state.world.nation_get_estimated_education_spending(nation_id);
+		total_expense += state.world.nation_get_estimated_administration_spending(nation_id);
+		total_expense += state.world.nation_get_estimated_military_spending(nation_id);
 		total_expense += economy::estimate_loan_payments(state, nation_id);
 		total_expense += economy::estimate_subsidy_spending(state, nation_id);
 
@@ -422,27 +422,27 @@ public:
 		text::add_line(state, contents, std::string_view("taxes_rich"), text::variable_type::val,
 				text::fp_one_place{ economy::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::rich) }); // $VAL
 		text::add_line(state, contents, std::string_view("tariffs_income"), text::variable_type::val,
-					text::fp_one_place{ economy::estimate_tariff_income(state, nation_id) }); // $VAL
+					text::fp_one_place{ state.world.nation_get_estimated_tariff_income(nation_id) }); // $VAL
 		text::add_line(state, contents, std::string_view("budget_exports")); // $VAL	TODO
-		text::add_line(state, contents, std::string_view("budget_gold"), text::variable_type::val, text::fp_one_place{ economy::estimate_gold_income(state, nation_id) }); // $VAL
+		text::add_line(state, contents, std::string_view("budget_gold"), text::variable_type::val, text::fp_one_place{ state.world.nation_get_estimated_gold_income(nation_id) }); // $VAL
 		text::add_line(state, contents, std::string_view("budget_total_expense"), text::variable_type::val,
 					text::fp_three_places{ -total_expense }); // $VAL TODO
 		text::add_line(state, contents, std::string_view("budget_expense_slider_education"),
 					text::variable_type::val,
 					text::fp_three_places{
-							-economy::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::education) }); // $VAL
+							-state.world.nation_get_estimated_education_spending(nation_id) }); // $VAL
 		text::add_line(state, contents, std::string_view("budget_slider_administration"),
 					text::variable_type::val,
 					text::fp_three_places{
-							-economy::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::administration) }); // $VAL
+							-state.world.nation_get_estimated_administration_spending(nation_id) }); // $VAL
 		text::add_line(state, contents, std::string_view("budget_slider_social_spending"),
 					text::variable_type::val,
 					text::fp_three_places{
-							-economy::estimate_social_spending(state, nation_id) }); // $VAL - presumably loan payments == interest (?)
+							-state.world.nation_get_estimated_social_spending(nation_id) }); // $VAL - presumably loan payments == interest (?)
 		text::add_line(state, contents, std::string_view("budget_slider_military_spending"),
 				text::variable_type::val,
 				text::fp_two_places{
-						-economy::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::military) }); // $VAL
+						-state.world.nation_get_estimated_military_spending(nation_id) }); // $VAL
 		text::add_line(state, contents, std::string_view("budget_interest"), text::variable_type::val,
 				text::fp_one_place{
 						-economy::estimate_loan_payments(state, nation_id) }); // $VAL - presumably loan payments == interest (?)
@@ -1967,6 +1967,10 @@ public:
 		}
 	}
 
+	uint32_t update_domains(sys::state& state) noexcept override {
+		return update_domain::simulation;
+	}
+
 private:
 	element_base* background_pic = nullptr;
 
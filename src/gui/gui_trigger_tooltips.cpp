@@ -119,12 +119,85 @@ inline void display_subtriggers(uint16_t const* source, sys::state& ws, text::la
 	uint16_t const *tval, sys::state &ws, text::layout_base &layout, int32_t primary_slot, int32_t this_slot, int32_t from_slot,   \
 			int32_t indentation, bool show_condition
 
+// Results of the conditions evaluated while building one description. An and / or scope is displayed with its
+// result followed by each of its members with theirs, so its result is combined from the (cached) results of its
+// members instead of evaluating the whole subtree again at every level of nesting. The cache lives as long as the
+// condition_cache_scope of the description being built; outside of one, conditions are simply evaluated.
+struct condition_key {
+	uint16_t const* tval = nullptr;
+	int32_t primary_slot = -1;
+	int32_t this_slot = -1;
+	int32_t from_slot = -1;
+
+	bool operator==(condition_key const& o) const noexcept {
+		return tval == o.tval && primary_slot == o.primary_slot && this_slot == o.this_slot && from_slot == o.from_slot;
+	}
+};
+struct condition_key_hash {
+	using is_avalanching = void;
+
+	auto operator()(condition_key const& k) const noexcept -> uint64_t {
+		uint64_t packed[3] = {uint64_t(reinterpret_cast<uintptr_t>(k.tval)),
+				(uint64_t(uint32_t(k.primary_slot)) << 32) | uint64_t(uint32_t(k.this_slot)), uint64_t(uint32_t(k.from_slot))};
+		return ankerl::unordered_dense::detail::wyhash::hash(packed, sizeof(packed));
+	}
+};
+struct condition_cache {
+	ankerl::unordered_dense::map<condition_key, bool, condition_key_hash> results;
+};
+
+static condition_cache* current_condition_cache = nullptr;
+
+class condition_cache_scope {
+	condition_cache cache;
+	condition_cache* previous = nullptr;
+
+public:
+	condition_cache_scope() : previous(current_condition_cache) {
+		current_condition_cache = &cache;
+	}
+	~condition_cache_scope() {
+		current_condition_cache = previous;
+	}
+	condition_cache_scope(condition_cache_scope const&) = delete;
+	condition_cache_scope& operator=(condition_cache_scope const&) = delete;
+};
+
+bool evaluate_condition(sys::state& ws, uint16_t const* tval, int32_t primary_slot, int32_t this_slot, int32_t from_slot) {
+	condition_key key{tval, primary_slot, this_slot, from_slot};
+	if(current_condition_cache) {
+		if(auto it = current_condition_cache->results.find(key); it != current_condition_cache->results.end())
+			return it->second;
+	}
+
+	bool result = false;
+	if((tval[0] & trigger::code_mask) == trigger::generic_scope) {
+		bool const disjunctive = (tval[0] & trigger::is_disjunctive_scope) != 0;
+		result = !disjunctive;
+
+		auto const source_size = 1 + trigger::get_trigger_payload_size(tval);
+		auto sub_units_start = tval + 2 + trigger::trigger_scope_data_payload(tval[0]);
+		while(sub_units_start < tval + source_size) {
+			// every member is displayed, so there is nothing to gain from short circuiting here
+			if(evaluate_condition(ws, sub_units_start, primary_slot, this_slot, from_slot) == disjunctive)
+				result = disjunctive;
+			sub_units_start += 1 + trigger::get_trigger_payload_size(sub_units_start);
+		}
+	} else {
+		result = trigger::evaluate(ws, tval, primary_slot, this_slot, from_slot);
+	}
+
+	if(current_condition_cache)
+		current_condition_cache->results.insert_or_assign(key, result);
+	return result;
+}
+
 void tf_none(TRIGGER_DISPLAY_PARAMS) { }
 
 void make_condition(TRIGGER_DISPLAY_PARAMS, text::layout_box& box) {
 	if(show_condition) {
 		
-			if(trigger::evaluate(ws, tval, primary_slot, this_slot, from_slot)) {
+			if(evaluate_condition(ws, tval, primary_slot, this_slot, from_slot)) {
 				text::add_to_layout_box(ws, layout, box, std::string_view("\x02"), text::text_color::green);
 				text::add_space_to_layout_box(ws, layout, box);
 			} else {
@@ -8414,6 +8487,7 @@ void trigger_description(sys::state& state, text::layout_base& layout, dcon::tri
 	if(!k)
 		return;
 
+	trigger_tooltip::condition_cache_scope conditions;
 	trigger_tooltip::make_trigger_description(state, layout, state.trigger_data.data() + state.trigger_data_indices[k.index() + 1],
 			primary_slot, this_slot, from_slot, 0, true);
 }
@@ -8421,6 +8495,7 @@ void trigger_description(sys::state& state, text::layout_base& layout, dcon::tri
 void multiplicative_value_modifier_description(sys::state& state, text::layout_base& layout, dcon::value_modifier_key modifier,
 		int32_t primary_slot, int32_t this_slot, int32_t from_slot) {
 	auto base = state.value_modifiers[modifier];
+	trigger_tooltip::condition_cache_scope conditions;
 
 	{
 		text::substitution_map map{};
@@ -8444,7 +8519,8 @@ void multiplicative_value_modifier_description(sys::state& state, text::layout_b
 		if(seg.condition) {
 			auto box = text::open_layout_box(layout, trigger_tooltip::indentation_amount);
 
-			if(trigger::evaluate(state, seg.condition, primary_slot, this_slot, from_slot)) {
+			auto condition = state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1];
+			if(trigger_tooltip::evaluate_condition(state, condition, primary_slot, this_slot, from_slot)) {
 				text::add_to_layout_box(state, layout, box, std::string_view("\x02"), text::text_color::green);
 				text::add_space_to_layout_box(state, layout, box);
 			} else {
@@ -8456,8 +8532,7 @@ void multiplicative_value_modifier_description(sys::state& state, text::layout_b
 					seg.factor >= 0.f ? text::text_color::green : text::text_color::red);
 			text::close_layout_box(layout, box);
 
-			trigger_tooltip::make_trigger_description(state, layout,
-					state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], primary_slot, this_slot, from_slot,
+			trigger_tooltip::make_trigger_description(state, layout, condition, primary_slot, this_slot, from_slot,
 					trigger_tooltip::indentation_amount * 2, true);
 		}
 	}
@@ -8466,6 +8541,7 @@ void multiplicative_value_modifier_description(sys::state& state, text::layout_b
 void additive_value_modifier_description(sys::state& state, text::layout_base& layout, dcon::value_modifier_key modifier,
 		int32_t primary_slot, int32_t this_slot, int32_t from_slot) {
 	auto base = state.value_modifiers[modifier];
+	trigger_tooltip::condition_cache_scope conditions;
 
 	if(base.factor == 1.0f) {
 		text::substitution_map map{};
@@ -8498,7 +8574,8 @@ void additive_value_modifier_description(sys::state& state, text::layout_base& l
 		if(seg.condition) {
 			auto box = text::open_layout_box(layout, trigger_tooltip::indentation_amount);
 
-			if(trigger::evaluate(state, seg.condition, primary_slot, this_slot, from_slot)) {
+			auto condition = state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1];
+			if(trigger_tooltip::evaluate_condition(state, condition, primary_slot, this_slot, from_slot)) {
 				text::add_to_layout_box(state, layout, box, std::string_view("\x02"), text::text_color::green);
 				text::add_space_to_layout_box(state, layout, box);
 			} else {
@@ -8510,8 +8587,7 @@ void additive_value_modifier_description(sys::state& state, text::layout_base& l
 					seg.factor >= 0.f ? text::text_color::green : text::text_color::red);
 			text::close_layout_box(layout, box);
 
-			trigger_tooltip::make_trigger_description(state, layout,
-					state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], primary_slot, this_slot, from_slot,
+			trigger_tooltip::make_trigger_description(state, layout, condition, primary_slot, this_slot, from_slot,
 					trigger_tooltip::indentation_amount * 2, true);
 		}
 	}
@@ -1303,7 +1303,7 @@ public:
 				state.selected_armies.clear();
 				state.selected_navies.clear();
 				set_visible(state, false);
-				state.game_state_updated.store(true, std::memory_order_release);
+				state.mark_ui_updated(update_domain::selection);
 				break;
 			}
 			default: 
@@ -1313,6 +1313,10 @@ public:
 		}
 		return message_result::unseen;
 	}
+
+	uint32_t update_domains(sys::state& state) noexcept override {
+		return update_domain::military | update_domain::selection;
+	}
 };
 
 class units_selected_text : public simple_text_element_base {
@@ -1347,7 +1351,7 @@ public:
 	void button_action(sys::state& state) noexcept override {
 		state.selected_armies.clear();
 		state.selected_navies.clear();
-		state.game_state_updated.store(true, std::memory_order_release);
+		state.mark_ui_updated(update_domain::selection);
 	}
 };
 
@@ -1848,6 +1852,11 @@ class mulit_unit_selection_panel : public main_window_element_base {
 			return nullptr;
 		}
 	}
+
+public:
+	uint32_t update_domains(sys::state& state) noexcept override {
+		return update_domain::military | update_domain::selection;
+	}
 };
 
 } // namespace ui
@@ -72,14 +72,14 @@ namespace ui {
 class nation_actual_stockpile_spending_text : public simple_text_element_base {
 public:
 	void on_update(sys::state& state) noexcept override {
-		set_text(state, text::format_money(economy::estimate_stockpile_filling_spending(state, state.local_player_nation)));
+		set_text(state, text::format_money(state.world.nation_get_estimated_stockpile_filling_spending(state.local_player_nation)));
 	}
 };
 
 class nation_gold_income_text : public simple_text_element_base {
 public:
 	void on_update(sys::state& state) noexcept override {
-		set_text(state, text::format_money(economy::estimate_gold_income(state, state.local_player_nation)));
+		set_text(state, text::format_money(state.world.nation_get_estimated_gold_income(state.local_player_nation)));
 	}
 };
 
@@ -93,7 +93,7 @@ public:
 class nation_diplomatic_balance_text : public simple_text_element_base {
 public:
 	void on_update(sys::state& state) noexcept override {
-		set_text(state, text::format_money(economy::estimate_diplomatic_balance(state, state.local_player_nation)));
+		set_text(state, text::format_money(state.world.nation_get_estimated_diplomatic_balance(state.local_player_nation)));
 	}
 	tooltip_behavior has_tooltip(sys::state& state) noexcept override {
 		return tooltip_behavior::variable_tooltip;
@@ -604,31 +604,31 @@ class budget_estimated_stockpile_spending_text : public budget_scaled_monetary_v
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
 		vals[uint8_t(budget_slider_target::construction_stock)] =
-				economy::estimate_construction_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::army_stock)] = economy::estimate_land_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::navy_stock)] = economy::estimate_naval_spending(state, state.local_player_nation);
+				state.world.nation_get_estimated_construction_spending(state.local_player_nation);
+		vals[uint8_t(budget_slider_target::army_stock)] = state.world.nation_get_estimated_land_spending(state.local_player_nation);
+		vals[uint8_t(budget_slider_target::navy_stock)] = state.world.nation_get_estimated_naval_spending(state.local_player_nation);
 	}
 };
 
 class budget_military_spending_text : public budget_scaled_monetary_value_text {
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
-		vals[uint8_t(budget_slider_target::army_stock)] = economy::estimate_land_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::navy_stock)] = economy::estimate_naval_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::army_stock)] = state.world.nation_get_estimated_land_spending(state.local_player_nation);
+		vals[uint8_t(budget_slider_target::navy_stock)] = state.world.nation_get_estimated_naval_spending(state.local_player_nation);
 	}
 };
 
 class budget_overseas_spending_text : public simple_text_element_base {
 public:
 	void on_update(sys::state& state) noexcept override {
-		set_text(state, text::format_money(economy::estimate_overseas_penalty_spending(state, state.local_player_nation)));
+		set_text(state, text::format_money(state.world.nation_get_estimated_overseas_penalty_spending(state.local_player_nation)));
 	}
 };
 
 class budget_tariff_income_text : public budget_scaled_monetary_value_text {
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
-		vals[uint8_t(budget_slider_target::tariffs)] = economy::estimate_tariff_income(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::tariffs)] = state.world.nation_get_estimated_tariff_income(state.local_player_nation);
 	}
 };
 
@@ -643,14 +643,14 @@ template<culture::income_type IncomeType, budget_slider_target BudgetTarget>
 class budget_expenditure_text : public budget_scaled_monetary_value_text {
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
-		vals[uint8_t(BudgetTarget)] = economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, IncomeType);
+		vals[uint8_t(BudgetTarget)] = economy::estimated_pop_payouts_by_income_type(state, state.local_player_nation, IncomeType);
 	}
 };
 
 class budget_social_spending_text : public budget_scaled_monetary_value_text {
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
-		vals[uint8_t(budget_slider_target::social)] = economy::estimate_social_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::social)] = state.world.nation_get_estimated_social_spending(state.local_player_nation);
 	}
 };
 
@@ -663,7 +663,7 @@ public:
 				economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::middle);
 		vals[uint8_t(budget_slider_target::rich_tax)] =
 				economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::rich);
-		vals[uint8_t(budget_slider_target::raw)] = economy::estimate_gold_income(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::raw)] = state.world.nation_get_estimated_gold_income(state.local_player_nation);
 	}
 };
 
@@ -671,20 +671,20 @@ class budget_expenditure_projection_text : public budget_scaled_monetary_value_t
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
 		vals[uint8_t(budget_slider_target::construction_stock)] =
-				economy::estimate_construction_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::army_stock)] = economy::estimate_land_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::navy_stock)] = economy::estimate_naval_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::social)] = economy::estimate_social_spending(state, state.local_player_nation);
+				state.world.nation_get_estimated_construction_spending(state.local_player_nation);
+		vals[uint8_t(budget_slider_target::army_stock)] = state.world.nation_get_estimated_land_spending(state.local_player_nation);
+		vals[uint8_t(budget_slider_target::navy_stock)] = state.world.nation_get_estimated_naval_spending(state.local_player_nation);
+		vals[uint8_t(budget_slider_target::social)] = state.world.nation_get_estimated_social_spending(state.local_player_nation);
 		vals[uint8_t(budget_slider_target::education)] =
-				economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::education);
+				state.world.nation_get_estimated_education_spending(state.local_player_nation);
 		vals[uint8_t(budget_slider_target::admin)] =
-				economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::administration);
+				state.world.nation_get_estimated_administration_spending(state.local_player_nation);
 		vals[uint8_t(budget_slider_target::military)] =
-				economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::military);
+				state.world.nation_get_estimated_military_spending(state.local_player_nation);
 		vals[uint8_t(budget_slider_target::raw)] = economy::estimate_loan_payments(state, state.local_player_nation);
 		vals[uint8_t(budget_slider_target::raw)] += economy::estimate_subsidy_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::raw)] += economy::estimate_overseas_penalty_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::raw)] += economy::estimate_stockpile_filling_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::raw)] += state.world.nation_get_estimated_overseas_penalty_spending(state.local_player_nation);
+		vals[uint8_t(budget_slider_target::raw)] += state.world.nation_get_estimated_stockpile_filling_spending(state.local_player_nation);
 	}
 };
 
@@ -698,27 +698,27 @@ public:
 				economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::middle);
 		vals[uint8_t(budget_slider_target::rich_tax)] =
 				economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::rich);
-		vals[uint8_t(budget_slider_target::raw)] = economy::estimate_gold_income(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::raw)] = state.world.nation_get_estimated_gold_income(state.local_player_nation);
 
 		// spend
 		vals[uint8_t(budget_slider_target::construction_stock)] =
-				-economy::estimate_construction_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::army_stock)] = -economy::estimate_land_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::navy_stock)] = -economy::estimate_naval_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::social)] = -economy::estimate_social_spending(state, state.local_player_nation);
+				-state.world.nation_get_estimated_construction_spending(state.local_player_nation);
+		vals[uint8_t(budget_slider_target::army_stock)] = -state.world.nation_get_estimated_land_spending(state.local_player_nation);
+		vals[uint8_t(budget_slider_target::navy_stock)] = -state.world.nation_get_estimated_naval_spending(state.local_player_nation);
+		vals[uint8_t(budget_slider_target::social)] = -state.world.nation_get_estimated_social_spending(state.local_player_nation);
 		vals[uint8_t(budget_slider_target::education)] =
-				-economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::education);
+				-state.world.nation_get_estimated_education_spending(state.local_player_nation);
 		vals[uint8_t(budget_slider_target::admin)] =
-				-economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::administration);
+				-state.world.nation_get_estimated_administration_spending(state.local_player_nation);
 		vals[uint8_t(budget_slider_target::military)] =
-				-economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::military);
+				-state.world.nation_get_estimated_military_spending(state.local_player_nation);
 		vals[uint8_t(budget_slider_target::raw)] += -economy::estimate_loan_payments(state, state.local_player_nation);
 		vals[uint8_t(budget_slider_target::raw)] += -economy::estimate_subsidy_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::raw)] += -economy::estimate_overseas_penalty_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::raw)] += -economy::estimate_stockpile_filling_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::raw)] += -state.world.nation_get_estimated_overseas_penalty_spending(state.local_player_nation);
+		vals[uint8_t(budget_slider_target::raw)] += -state.world.nation_get_estimated_stockpile_filling_spending(state.local_player_nation);
 		// balance
-		vals[uint8_t(budget_slider_target::raw)] += economy::estimate_diplomatic_balance(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::tariffs)] = economy::estimate_tariff_income(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::raw)] += state.world.nation_get_estimated_diplomatic_balance(state.local_player_nation);
+		vals[uint8_t(budget_slider_target::tariffs)] = state.world.nation_get_estimated_tariff_income(state.local_player_nation);
 	}
 };
 
@@ -1163,6 +1163,10 @@ public:
 
 		return message_result::unseen;
 	}
+
+	uint32_t update_domains(sys::state& state) noexcept override {
+		return update_domain::economy;
+	}
 };
 
 } // namespace ui
@@ -2476,6 +2476,10 @@ public:
 		}
 		return generic_tabbed_window<diplomacy_window_tab>::get(state, payload);
 	}
+
+	uint32_t update_domains(sys::state& state) noexcept override {
+		return update_domain::diplomacy | update_domain::politics;
+	}
 };
 
 } // namespace ui
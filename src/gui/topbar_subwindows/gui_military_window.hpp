@@ -212,6 +212,10 @@ public:
 		}
 		return message_result::unseen;
 	}
+
+	uint32_t update_domains(sys::state& state) noexcept override {
+		return update_domain::military | update_domain::selection;
+	}
 };
 
 } // namespace ui
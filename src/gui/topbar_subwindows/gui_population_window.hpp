@@ -2877,6 +2877,9 @@ private:
 	dcon::state_instance_id focus_state{};
 	pop_list_sort sort = pop_list_sort::size;
 	bool sort_ascend = true;
+	sorted_row_model<dcon::pop_id> pop_order;
+	pop_list_sort pop_order_sort = pop_list_sort::size;
+	bool pop_order_ascend = true;
 
 	void update_pop_list(sys::state& state) {
 		country_pop_listbox->row_contents.clear();
@@ -2908,131 +2911,55 @@ private:
 		}
 	}
 
-	void sort_pop_list(sys::state& state) {
-		std::function<bool(dcon::pop_id, dcon::pop_id)> fn;
+	float pop_sort_key(sys::state& state, dcon::pop_id p) {
 		switch(sort) {
 		case pop_list_sort::type:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_poptype().id.index() < b_fat_id.get_poptype().id.index();
-			};
-			break;
+			return float(state.world.pop_get_poptype(p).index());
 		case pop_list_sort::size:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_size() > b_fat_id.get_size();
-			};
-			break;
+			return -state.world.pop_get_size(p);
 		case pop_list_sort::con:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_consciousness() > b_fat_id.get_consciousness();
-			};
-			break;
+			return -state.world.pop_get_consciousness(p);
 		case pop_list_sort::mil:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_militancy() > b_fat_id.get_militancy();
-			};
-			break;
+			return -state.world.pop_get_militancy(p);
 		case pop_list_sort::religion:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_religion().id.index() < b_fat_id.get_religion().id.index();
-			};
-			break;
+			return float(state.world.pop_get_religion(p).index());
 		case pop_list_sort::nationality:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_culture().id.index() < b_fat_id.get_culture().id.index();
-			};
-			break;
+			return float(state.world.pop_get_culture(p).index());
 		case pop_list_sort::location:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_pop_location_as_pop().id.index() < b_fat_id.get_pop_location_as_pop().id.index();
-			};
-			break;
+			return float(state.world.pop_get_pop_location_as_pop(p).index());
 		case pop_list_sort::cash:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_savings() > b_fat_id.get_savings();
-			};
-			break;
+			return -state.world.pop_get_savings(p);
 		case pop_list_sort::unemployment:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_employment() < b_fat_id.get_employment();
-			};
-			break;
+			return state.world.pop_get_employment(p);
 		case pop_list_sort::ideology:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_dominant_ideology().id.index() < b_fat_id.get_dominant_ideology().id.index();
-			};
-			break;
+			return float(state.world.pop_get_dominant_ideology(p).index());
 		case pop_list_sort::issues:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_dominant_issue_option().id.index() < b_fat_id.get_dominant_issue_option().id.index();
-			};
-			break;
+			return float(state.world.pop_get_dominant_issue_option(p).index());
 		case pop_list_sort::life_needs:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_life_needs_satisfaction() > b_fat_id.get_life_needs_satisfaction();
-			};
-			break;
+			return -state.world.pop_get_life_needs_satisfaction(p);
 		case pop_list_sort::everyday_needs:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_everyday_needs_satisfaction() > b_fat_id.get_everyday_needs_satisfaction();
-			};
-			break;
+			return -state.world.pop_get_everyday_needs_satisfaction(p);
 		case pop_list_sort::luxury_needs:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_luxury_needs_satisfaction() > b_fat_id.get_luxury_needs_satisfaction();
-			};
-			break;
+			return -state.world.pop_get_luxury_needs_satisfaction(p);
 		case pop_list_sort::literacy:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.get_literacy() > b_fat_id.get_literacy();
-			};
-			break;
+			return -state.world.pop_get_literacy(p);
 		// TODO: Implement revoltrisk and growth sorts
 		case pop_list_sort::revoltrisk:
 		case pop_list_sort::change:
-			fn = [&](dcon::pop_id a, dcon::pop_id b) {
-				auto a_fat_id = dcon::fatten(state.world, a);
-				auto b_fat_id = dcon::fatten(state.world, b);
-				return a_fat_id.id.index() < b_fat_id.id.index();
-			};
-			break;
+			return float(p.index());
 		}
-		std::stable_sort(country_pop_listbox->row_contents.begin(), country_pop_listbox->row_contents.end(),
-				[&](dcon::pop_id a, dcon::pop_id b) {
-					return fn(a, b);
-				});
-		if(!sort_ascend) {
-			std::reverse(country_pop_listbox->row_contents.begin(), country_pop_listbox->row_contents.end());
+		return 0.0f;
+	}
+
+	void sort_pop_list(sys::state& state) {
+		// the previous order is only a useful starting point while the sort criterion stays the same
+		if(sort != pop_order_sort || sort_ascend != pop_order_ascend) {
+			pop_order.reset();
+			pop_order_sort = sort;
+			pop_order_ascend = sort_ascend;
 		}
+		float const direction = sort_ascend ? 1.0f : -1.0f;
+		pop_order.sort(country_pop_listbox->row_contents, [&](dcon::pop_id p) { return direction * pop_sort_key(state, p); });
 	}
 
 	void populate_left_side_list(sys::state& state) {
@@ -3328,6 +3255,10 @@ public:
 	friend class pop_national_focus_button;
 	friend std::vector<dcon::pop_id> const& get_pop_window_list(sys::state& state);
 	friend dcon::pop_id get_pop_details_pop(sys::state& state);
+
+	uint32_t update_domains(sys::state& state) noexcept override {
+		return update_domain::pops;
+	}
 };
 
 void pop_national_focus_button::button_action(sys::state& state) noexcept {
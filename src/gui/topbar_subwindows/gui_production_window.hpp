@@ -1281,97 +1281,64 @@ void populate_production_states_list(sys::state& state, std::vector<dcon::state_
 		}
 	}
 
-	auto sort_by_name = [&](dcon::state_instance_id a, dcon::state_instance_id b) {
-		auto a_name =
-				text::produce_simple_string(state, state.world.state_definition_get_name(state.world.state_instance_get_definition(a)));
-		auto b_name =
-				text::produce_simple_string(state, state.world.state_definition_get_name(state.world.state_instance_get_definition(b)));
-		return a_name < b_name;
-	};
-	auto sort_by_factories = [&](dcon::state_instance_id a, dcon::state_instance_id b) {
-		size_t acount = 0;
-		province::for_each_province_in_state_instance(state, a, [&](dcon::province_id pid) {
-			auto ffact_id = dcon::fatten(state.world, pid);
-			ffact_id.for_each_factory_location_as_province([&](dcon::factory_location_id flid) {
-				auto fid = state.world.factory_location_get_factory(flid);
-				Cyto::Any payload = commodity_filter_query_data{
-						state.world.factory_type_get_output(state.world.factory_get_building_type(fid)).id, false};
-				state.ui_state.production_subwindow->impl_get(state, payload);
-				auto content = any_cast<commodity_filter_query_data>(payload);
-				acount += content.filter ? 1 : 0;
+	// sort keys are computed once per state rather than once per comparison
+	if(sort_order == production_sort_order::name) {
+		std::vector<std::pair<std::string, dcon::state_instance_id>> named;
+		named.reserve(row_contents.size());
+		for(auto si : row_contents)
+			named.emplace_back(text::produce_simple_string(state, state.world.state_definition_get_name(state.world.state_instance_get_definition(si))), si);
+		std::stable_sort(named.begin(), named.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+		for(size_t i = 0; i < named.size(); ++i)
+			row_contents[i] = named[i].second;
+		return;
+	}
+
+	auto key_of = [&](dcon::state_instance_id si) {
+		switch(sort_order) {
+		case production_sort_order::factories:
+		{
+			float count = 0.0f;
+			province::for_each_province_in_state_instance(state, si, [&](dcon::province_id pid) {
+				auto ffact_id = dcon::fatten(state.world, pid);
+				ffact_id.for_each_factory_location_as_province([&](dcon::factory_location_id flid) {
+					auto fid = state.world.factory_location_get_factory(flid);
+					Cyto::Any payload = commodity_filter_query_data{
+							state.world.factory_type_get_output(state.world.factory_get_building_type(fid)).id, false};
+					state.ui_state.production_subwindow->impl_get(state, payload);
+					auto content = any_cast<commodity_filter_query_data>(payload);
+					count += content.filter ? 1.0f : 0.0f;
+				});
 			});
-		});
-
-		size_t bcount = 0;
-		province::for_each_province_in_state_instance(state, b, [&](dcon::province_id pid) {
-			auto ffact_id = dcon::fatten(state.world, pid);
-			ffact_id.for_each_factory_location_as_province([&](dcon::factory_location_id flid) {
-				auto fid = state.world.factory_location_get_factory(flid);
-				Cyto::Any payload = commodity_filter_query_data{
-						state.world.factory_type_get_output(state.world.factory_get_building_type(fid)).id, false};
-				state.ui_state.production_subwindow->impl_get(state, payload);
-				auto content = any_cast<commodity_filter_query_data>(payload);
-				bcount += content.filter ? 1 : 0;
+			return -count;
+		}
+		case production_sort_order::primary_workers:
+			return -state.world.state_instance_get_demographics(si, demographics::to_key(state, state.culture_definitions.primary_factory_worker));
+		case production_sort_order::secondary_workers:
+			return -state.world.state_instance_get_demographics(si, demographics::to_key(state, state.culture_definitions.secondary_factory_worker));
+		case production_sort_order::owners:
+			return -state.world.state_instance_get_demographics(si, demographics::to_key(state, state.culture_definitions.capitalists)) /
+				state.world.state_instance_get_demographics(si, demographics::total);
+		case production_sort_order::infrastructure:
+		{
+			float total = 0.0f;
+			float p_total = 0.0f;
+			province::for_each_province_in_state_instance(state, si, [&](dcon::province_id p) {
+				total += float(state.world.province_get_building_level(p, economy::province_building_type::railroad));
+				p_total += 1.0f;
 			});
-		});
-		return acount > bcount;
-	};
-	auto sort_by_primary_workers = [&](dcon::state_instance_id a, dcon::state_instance_id b) {
-		return state.world.state_instance_get_demographics(a,
-							 demographics::to_key(state, state.culture_definitions.primary_factory_worker)) >
-					 state.world.state_instance_get_demographics(b,
-							 demographics::to_key(state, state.culture_definitions.primary_factory_worker));
-	};
-	auto sort_by_secondary_workers = [&](dcon::state_instance_id a, dcon::state_instance_id b) {
-		return state.world.state_instance_get_demographics(a,
-							 demographics::to_key(state, state.culture_definitions.secondary_factory_worker)) >
-					 state.world.state_instance_get_demographics(b,
-							 demographics::to_key(state, state.culture_definitions.secondary_factory_worker));
-	};
-	auto sort_by_owners = [&](dcon::state_instance_id a, dcon::state_instance_id b) {
-		auto atotal = state.world.state_instance_get_demographics(a, demographics::total);
-		auto btotal = state.world.state_instance_get_demographics(b, demographics::total);
-		return state.world.state_instance_get_demographics(a, demographics::to_key(state, state.culture_definitions.capitalists)) /
-							 atotal >
-					 state.world.state_instance_get_demographics(b, demographics::to_key(state, state.culture_definitions.capitalists)) /
-							 btotal;
-	};
-	auto sort_by_infrastructure = [&](dcon::state_instance_id a, dcon::state_instance_id b) {
-		float atotal = 0.0f;
-		float ap_total = 0.0f;
-		province::for_each_province_in_state_instance(state, a, [&](dcon::province_id p) {
-			atotal += float(state.world.province_get_building_level(p, economy::province_building_type::railroad));
-			ap_total += 1.0f;
-		});
-		float btotal = 0.0f;
-		float bp_total = 0.0f;
-		province::for_each_province_in_state_instance(state, b, [&](dcon::province_id p) {
-			btotal += float(state.world.province_get_building_level(p, economy::province_building_type::railroad));
-			bp_total += 1.0f;
-		});
-		return atotal / ap_total > btotal / bp_total;
+			return -total / p_total;
+		}
+		default:
+			return 0.0f;
+		}
 	};
-
-	switch(sort_order) {
-	case production_sort_order::name:
-		std::sort(row_contents.begin(), row_contents.end(), sort_by_name);
-		break;
-	case production_sort_order::factories:
-		std::sort(row_contents.begin(), row_contents.end(), sort_by_factories);
-		break;
-	case production_sort_order::primary_workers:
-		std::sort(row_contents.begin(), row_contents.end(), sort_by_primary_workers);
-		break;
-	case production_sort_order::secondary_workers:
-		std::sort(row_contents.begin(), row_contents.end(), sort_by_secondary_workers);
-		break;
-	case production_sort_order::owners:
-		std::sort(row_contents.begin(), row_contents.end(), sort_by_owners);
-		break;
-	case production_sort_order::infrastructure:
-		std::sort(row_contents.begin(), row_contents.end(), sort_by_infrastructure);
-		break;
-	}
+	std::vector<std::pair<float, dcon::state_instance_id>> keyed;
+	keyed.reserve(row_contents.size());
+	for(auto si : row_contents)
+		keyed.emplace_back(key_of(si), si);
+	std::stable_sort(keyed.begin(), keyed.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+	for(size_t i = 0; i < keyed.size(); ++i)
+		row_contents[i] = keyed[i].second;
 }
 
 struct production_foreign_invest_target {
@@ -1873,6 +1840,10 @@ public:
 		}
 		return message_result::unseen;
 	}
+
+	uint32_t update_domains(sys::state& state) noexcept override {
+		return update_domain::economy;
+	}
 };
 
 void open_foreign_investment(sys::state& state, dcon::nation_id n) {
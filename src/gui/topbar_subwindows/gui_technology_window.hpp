@@ -1659,6 +1659,10 @@ public:
 		}
 		return message_result::unseen;
 	}
+
+	uint32_t update_domains(sys::state& state) noexcept override {
+		return update_domain::technology;
+	}
 };
 
 } // namespace ui
@@ -1302,6 +1302,10 @@ public:
 		}
 		return message_result::unseen;
 	}
+
+	uint32_t update_domains(sys::state& state) noexcept override {
+		return update_domain::economy;
+	}
 };
 
 } // namespace ui
@@ -172,7 +172,7 @@ public:
 		auto id = retrieve<dcon::decision_id>(state, parent);
 		if(bool(id)) {
 			state.world.decision_set_hide_notification(id, !state.world.decision_get_hide_notification(id));
-			state.game_state_updated.store(true, std::memory_order_release);
+			state.mark_ui_updated(update_domain::politics);
 		}
 	}
 
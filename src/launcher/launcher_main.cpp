@@ -321,13 +321,24 @@ native_string to_hex(uint64_t v) {
 	return ret;
 }
 
-void make_mod_file() {
+void make_mod_file(bool force_rebuild) {
 	file_is_ready.store(false, std::memory_order::memory_order_seq_cst);
 	auto path = produce_mod_path();
-	std::thread file_maker([path]() {
+	std::thread file_maker([path, force_rebuild]() {
 		auto game_state = std::make_unique<sys::state>();
 		simple_fs::restore_state(game_state->common_fs, path);
 
+		// an existing scenario built from identical files would come out the same, so select it instead of rebuilding
+		auto source_checksum = sys::scenario_source_checksum(game_state->common_fs);
+		for(auto& f : scenario_files) {
+			if(!force_rebuild && f.ident.mod_path == path && f.ident.source_checksum.is_equal(source_checksum)) {
+				selected_scenario_file = f.file_name;
+				file_is_ready.store(true, std::memory_order::memory_order_release);
+				InvalidateRect((HWND)(m_hwnd), nullptr, FALSE);
+				return;
+			}
+		}
+
 		parsers::error_handler err("");
 		game_state->load_scenario_data(err);
 
@@ -342,7 +353,10 @@ void make_mod_file() {
 
 		++max_scenario_count;
 		selected_scenario_file = base_name + L"-" + std::to_wstring(append) + L".bin";
-		sys::write_scenario_file(*game_state, selected_scenario_file, max_scenario_count);
+		sys::write_scenario_file(*game_state, selected_scenario_file, max_scenario_count, source_checksum);
+		// the ui thread leaves the list alone until file_is_ready is set again
+		scenario_files.push_back(scenario_file{selected_scenario_file,
+				sys::mod_identifier{path, game_state->scenario_time_stamp, max_scenario_count, source_checksum}});
 
 		if(!err.accumulated_errors.empty() || !err.accumulated_warnings.empty()) {
 			auto assembled_file = std::string("The following problems were encountered while creating the scenario:\r\n\r\nWarnings:\r\n") + err.accumulated_warnings + "\r\n\r\nErrors:\r\n" + err.accumulated_errors;
@@ -409,7 +423,7 @@ void mouse_click() {
 			return;
 		case ui_obj_create_scenario:
 			if(file_is_ready.load(std::memory_order::memory_order_acquire)) {
-				make_mod_file();
+				make_mod_file(GetKeyState(VK_SHIFT) < 0); // shift click always rebuilds
 				InvalidateRect((HWND)(m_hwnd), nullptr, FALSE);
 			}
 			return;
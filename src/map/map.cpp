@@ -689,7 +689,35 @@ void display_data::set_selected_province(sys::state& state, dcon::province_id pr
 }
 
 void display_data::set_province_color(std::vector<uint32_t> const& prov_color) {
-	gen_prov_color_texture(province_color, prov_color, 2);
+	if(uploaded_province_color.size() != prov_color.size()) {
+		gen_prov_color_texture(province_color, prov_color, 2);
+		uploaded_province_color = prov_color;
+		return;
+	}
+
+	// each layer is a whole number of 256 texel rows; upload the span of rows between the first and last changed texel
+	uint32_t const layer_size = uint32_t(prov_color.size() / 2);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, province_color);
+	for(uint32_t layer = 0; layer < 2; ++layer) {
+		uint32_t const base = layer * layer_size;
+		uint32_t first = layer_size;
+		uint32_t last = 0;
+		for(uint32_t i = 0; i < layer_size; ++i) {
+			if(prov_color[base + i] != uploaded_province_color[base + i]) {
+				first = std::min(first, i);
+				last = i;
+			}
+		}
+		if(first == layer_size)
+			continue;
+
+		uint32_t const first_row = first / 256;
+		uint32_t const last_row = last / 256;
+		glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, first_row, layer, 256, last_row - first_row + 1, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+				&prov_color[base + first_row * 256]);
+	}
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+	uploaded_province_color = prov_color;
 }
 
 void add_drag_box_line(std::vector<screen_vertex>& drag_box_vertices, glm::vec2 pos1, glm::vec2 pos2, glm::vec2 size, bool vertical) {
@@ -914,6 +942,7 @@ void display_data::set_text_lines(sys::state& state, std::vector<text_line_gener
 				//assert(xf >= 0.f && xf <= 1.f);
 			}
 			if(e.text[i] != ' ') { // skip spaces, only leaving a , well, space!
+				f.make_glyph(e.text[i]);
 				// Add up baseline and kerning offsets
 				auto dpoly_fn = [&](float x) {
 					// y = a + 1bx^1 + 1cx^2 + 1dx^3
@@ -1007,6 +1036,7 @@ void display_data::load_map(sys::state& state) {
 	glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_RGBA8, 256, 256, 2);
 	set_gltex_parameters(province_color, GL_TEXTURE_2D_ARRAY, GL_NEAREST, GL_CLAMP_TO_EDGE);
 	glBindTexture(GL_TEXTURE_2D, 0);
+	uploaded_province_color.clear();
 
 	// Get the province_highlight handle
 	glGenTextures(1, &province_highlight);
@@ -147,6 +147,8 @@ public:
 
 	// map pixel -> province id
 	std::vector<uint16_t> province_id_map;
+	// the contents of the province color texture, so that only the rows that change have to be uploaded again
+	std::vector<uint32_t> uploaded_province_color;
 
 private:
 	// Meshes
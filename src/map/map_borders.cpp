@@ -155,6 +155,31 @@ int32_t get_border_index(uint16_t map_province_id1, uint16_t map_province_id2, p
 	return border_index.index();
 }
 
+// Rows of the map traced together by one task
+constexpr uint32_t border_band_height = 32;
+
+// The borders found in one band of rows. Since the bands are traced in parallel they cannot create the province
+// adjacencies themselves; instead each band numbers the province pairs in the order it first meets them, and the
+// adjacencies are created afterwards by walking the bands in order, which creates them in the same order as a
+// single top to bottom scan would.
+struct border_band {
+	std::vector<std::pair<uint16_t, uint16_t>> pairs;
+	ankerl::unordered_dense::map<uint32_t, int32_t> pair_index;
+	// indexed by the position of the pair in pairs
+	std::vector<std::vector<border_vertex>> vertices;
+
+	int32_t local_index(uint16_t map_province_id1, uint16_t map_province_id2) {
+		auto key = (uint32_t(map_province_id1) << 16) | uint32_t(map_province_id2);
+		if(auto it = pair_index.find(key); it != pair_index.end())
+			return it->second;
+		auto index = int32_t(pairs.size());
+		pairs.emplace_back(map_province_id1, map_province_id2);
+		pair_index.insert_or_assign(key, index);
+		vertices.emplace_back();
+		return index;
+	}
+};
+
 void add_border(
 	const uint32_t& x0,
 	const uint32_t& y0,
@@ -162,10 +187,9 @@ void add_border(
 	const uint16_t& id_ur,
 	const uint16_t& id_dl,
 	const uint16_t& id_dr,
-	std::vector<std::vector<border_vertex>>& borders_list_vertices,
+	border_band& band,
 	std::vector<BorderDirection>& current_row,
 	std::vector<BorderDirection>& last_row,
-	parsers::scenario_building_context& context,
 	glm::vec2& map_size)
 {
 	uint8_t diff_u = id_ul != id_ur;
@@ -176,10 +200,8 @@ void add_border(
 	glm::vec2 map_pos(x0, y0);
 
 	auto add_line_helper = [&](glm::vec2 pos1, glm::vec2 pos2, uint16_t id1, uint16_t id2, direction dir) {
-		auto border_index = get_border_index(id1, id2, context);
-		if(uint32_t(border_index) >= borders_list_vertices.size())
-			borders_list_vertices.resize(border_index + 1);
-		auto& current_border_vertices = borders_list_vertices[border_index];
+		auto border_index = band.local_index(id1, id2);
+		auto& current_border_vertices = band.vertices[border_index];
 		if(!extend_if_possible(x0, border_index, dir, last_row, current_row, map_size, current_border_vertices))
 			add_line(map_pos, map_size, pos1, pos2, border_index, x0, dir, current_border_vertices, current_row, 0.5f);
 		};
@@ -213,57 +235,68 @@ void display_data::load_border_data(parsers::scenario_building_context& context)
 
 	glm::vec2 map_size(size_x, size_y);
 
-	std::vector<std::vector<border_vertex>> borders_list_vertices;
+	uint32_t const band_count = (size_y - 1 + border_band_height - 1) / border_band_height;
+	std::vector<border_band> bands(band_count);
 
-	// The borders of the current row and last row
-	std::vector<BorderDirection> current_row(size_x);
-	std::vector<BorderDirection> last_row(size_x);
+	concurrency::parallel_for(uint32_t(0), band_count, [&](uint32_t band_index) {
+		auto& band = bands[band_index];
 
+		// The borders of the current row and last row. A band starts without a last row, so a border crossing into it
+		// from the band above starts a new line segment there rather than extending the one above.
+		std::vector<BorderDirection> current_row(size_x);
+		std::vector<BorderDirection> last_row(size_x);
 
-	for(uint32_t y = 0; y < size_y - 1; y++) {
-		for(uint32_t x = 0; x < size_x - 1; x++) {
-			auto prov_id_ul = province_id_map[(x + 0) + (y + 0) * size_x];
-			auto prov_id_ur = province_id_map[(x + 1) + (y + 0) * size_x];
-			auto prov_id_dl = province_id_map[(x + 0) + (y + 1) * size_x];
-			auto prov_id_dr = province_id_map[(x + 1) + (y + 1) * size_x];
+		auto check_quad = [&](uint32_t x, uint32_t y, uint16_t prov_id_ul, uint16_t prov_id_ur, uint16_t prov_id_dl, uint16_t prov_id_dr) {
 			if(prov_id_ul != prov_id_ur || prov_id_ul != prov_id_dl || prov_id_ul != prov_id_dr) {
-				add_border(x, y, prov_id_ul, prov_id_ur, prov_id_dl, prov_id_dr, borders_list_vertices, current_row, last_row, context, map_size);
+				add_border(x, y, prov_id_ul, prov_id_ur, prov_id_dl, prov_id_dr, band, current_row, last_row, map_size);
 				if(prov_id_ul != prov_id_ur && prov_id_ur != 0 && prov_id_ul != 0) {
-					context.state.world.try_create_province_adjacency(province::from_map_id(prov_id_ul), province::from_map_id(prov_id_ur));
+					band.local_index(prov_id_ul, prov_id_ur);
 				}
 				if(prov_id_ul != prov_id_dl && prov_id_dl != 0 && prov_id_ul != 0) {
-					context.state.world.try_create_province_adjacency(province::from_map_id(prov_id_ul), province::from_map_id(prov_id_dl));
+					band.local_index(prov_id_ul, prov_id_dl);
 				}
 				if(prov_id_ul != prov_id_dr && prov_id_dr != 0 && prov_id_ul != 0) {
-					context.state.world.try_create_province_adjacency(province::from_map_id(prov_id_ul), province::from_map_id(prov_id_dr));
+					band.local_index(prov_id_ul, prov_id_dr);
 				}
 			}
-		}
+		};
 
-		{
-			// handle the international date line
-			auto prov_id_ul = province_id_map[((size_x - 1) + 0) + (y + 0) * size_x];
-			auto prov_id_ur = province_id_map[0 + (y + 0) * size_x];
-			auto prov_id_dl = province_id_map[((size_x - 1) + 0) + (y + 1) * size_x];
-			auto prov_id_dr = province_id_map[0 + (y + 1) * size_x];
+		uint32_t const y_end = std::min((band_index + 1) * border_band_height, size_y - 1);
+		for(uint32_t y = band_index * border_band_height; y < y_end; y++) {
+			for(uint32_t x = 0; x < size_x - 1; x++) {
+				check_quad(x, y,
+					province_id_map[(x + 0) + (y + 0) * size_x],
+					province_id_map[(x + 1) + (y + 0) * size_x],
+					province_id_map[(x + 0) + (y + 1) * size_x],
+					province_id_map[(x + 1) + (y + 1) * size_x]);
+			}
 
-			if(prov_id_ul != prov_id_ur || prov_id_ul != prov_id_dl || prov_id_ul != prov_id_dr) {
-				add_border((size_x - 1), y, prov_id_ul, prov_id_ur, prov_id_dl, prov_id_dr, borders_list_vertices, current_row, last_row, context, map_size);
+			// handle the international date line
+			check_quad((size_x - 1), y,
+				province_id_map[((size_x - 1) + 0) + (y + 0) * size_x],
+				province_id_map[0 + (y + 0) * size_x],
+				province_id_map[((size_x - 1) + 0) + (y + 1) * size_x],
+				province_id_map[0 + (y + 1) * size_x]);
+
+			// Move the border_direction rows a step down
+			std::swap(last_row, current_row);
+			std::fill(current_row.begin(), current_row.end(), BorderDirection{});
+		}
+	});
 
-				if(prov_id_ul != prov_id_ur && prov_id_ur != 0 && prov_id_ul != 0) {
-					context.state.world.try_create_province_adjacency(province::from_map_id(prov_id_ul), province::from_map_id(prov_id_ur));
-				}
-				if(prov_id_ul != prov_id_dl && prov_id_dl != 0 && prov_id_ul != 0) {
-					context.state.world.try_create_province_adjacency(province::from_map_id(prov_id_ul), province::from_map_id(prov_id_dl));
-				}
-				if(prov_id_ul != prov_id_dr && prov_id_dr != 0 && prov_id_ul != 0) {
-					context.state.world.try_create_province_adjacency(province::from_map_id(prov_id_ul), province::from_map_id(prov_id_dr));
-				}
+	// Create the adjacencies in scan order and move the vertices over to their final border ids
+	std::vector<std::vector<border_vertex>> borders_list_vertices;
+	for(auto& band : bands) {
+		for(uint32_t i = 0; i < band.pairs.size(); ++i) {
+			auto border_index = get_border_index(band.pairs[i].first, band.pairs[i].second, context);
+			if(uint32_t(border_index) >= borders_list_vertices.size())
+				borders_list_vertices.resize(border_index + 1);
+			auto& current_border_vertices = borders_list_vertices[border_index];
+			for(auto& v : band.vertices[i]) {
+				v.border_id_ = border_index;
+				current_border_vertices.push_back(v);
 			}
 		}
-		// Move the border_direction rows a step down
-		std::swap(last_row, current_row);
-		std::fill(current_row.begin(), current_row.end(), BorderDirection{});
 	}
 
 	/*
@@ -405,61 +438,76 @@ void load_river_crossings(parsers::scenario_building_context& context, std::vect
 std::vector<border_vertex> create_river_vertices(display_data const& data, parsers::scenario_building_context& context, std::vector<uint8_t> const& river_data) {
 	auto size = glm::ivec2(data.size_x, data.size_y);
 	load_river_crossings(context, river_data, size);
-
-	std::vector<border_vertex> river_vertices;
-
-	std::vector<BorderDirection> current_row(size.x);
-	std::vector<BorderDirection> last_row(size.x);
 	auto map_size = glm::vec2(data.size_x, data.size_y);
 
-	auto add_river = [&](uint32_t x0, uint32_t y0, bool river_u, bool river_d, bool river_r, bool river_l) {
-		glm::vec2 map_pos(x0, y0);
-
-		auto add_line_helper = [&](glm::vec2 pos1, glm::vec2 pos2, direction dir) {
-			// if(!extend_if_possible(x0, 0, dir, last_row, current_row, size, river_vertices))
-			add_line(map_pos, map_size, pos1, pos2, 0, x0, dir, river_vertices, current_row, 0.0f);
+	// The river lines don't depend on each other, so the rows are traced in bands in parallel and joined in order
+	int32_t const band_count = std::max((size.y - 2 + int32_t(border_band_height) - 1) / int32_t(border_band_height), 0);
+	std::vector<std::vector<border_vertex>> band_vertices(band_count);
+
+	concurrency::parallel_for(int32_t(0), band_count, [&](int32_t band_index) {
+		auto& river_vertices = band_vertices[band_index];
+
+		std::vector<BorderDirection> current_row(size.x);
+		std::vector<BorderDirection> last_row(size.x);
+
+		auto add_river = [&](uint32_t x0, uint32_t y0, bool river_u, bool river_d, bool river_r, bool river_l) {
+			glm::vec2 map_pos(x0, y0);
+
+			auto add_line_helper = [&](glm::vec2 pos1, glm::vec2 pos2, direction dir) {
+				// if(!extend_if_possible(x0, 0, dir, last_row, current_row, size, river_vertices))
+				add_line(map_pos, map_size, pos1, pos2, 0, x0, dir, river_vertices, current_row, 0.0f);
+				};
+
+			if(river_l && river_u && !river_r && !river_d) { // Upper left
+				add_line_helper(glm::vec2(0.0f, 0.5f), glm::vec2(0.5f, 0.0f), direction::UP_LEFT);
+			} else if(river_l && river_d && !river_r && !river_u) { // Lower left
+				add_line_helper(glm::vec2(0.0f, 0.5f), glm::vec2(0.5f, 1.0f), direction::DOWN_LEFT);
+			} else if(river_r && river_u && !river_l && !river_d) { // Upper right
+				add_line_helper(glm::vec2(1.0f, 0.5f), glm::vec2(0.5f, 0.0f), direction::UP_RIGHT);
+			} else if(river_r && river_d && !river_l && !river_u) { // Lower right
+				add_line_helper(glm::vec2(1.0f, 0.5f), glm::vec2(0.5f, 1.0f), direction::DOWN_RIGHT);
+			} else {
+				if(river_u) {
+					add_line_helper(glm::vec2(0.5f, 0.0f), glm::vec2(0.5f, 0.5f), direction::UP);
+				}
+				if(river_d) {
+					add_line_helper(glm::vec2(0.5f, 0.5f), glm::vec2(0.5f, 1.0f), direction::DOWN);
+				}
+				if(river_l) {
+					add_line_helper(glm::vec2(0.0f, 0.5f), glm::vec2(0.5f, 0.5f), direction::LEFT);
+				}
+				if(river_r) {
+					add_line_helper(glm::vec2(0.5f, 0.5f), glm::vec2(1.0f, 0.5f), direction::RIGHT);
+				}
+			}
 			};
 
-		if(river_l && river_u && !river_r && !river_d) { // Upper left
-			add_line_helper(glm::vec2(0.0f, 0.5f), glm::vec2(0.5f, 0.0f), direction::UP_LEFT);
-		} else if(river_l && river_d && !river_r && !river_u) { // Lower left
-			add_line_helper(glm::vec2(0.0f, 0.5f), glm::vec2(0.5f, 1.0f), direction::DOWN_LEFT);
-		} else if(river_r && river_u && !river_l && !river_d) { // Upper right
-			add_line_helper(glm::vec2(1.0f, 0.5f), glm::vec2(0.5f, 0.0f), direction::UP_RIGHT);
-		} else if(river_r && river_d && !river_l && !river_u) { // Lower right
-			add_line_helper(glm::vec2(1.0f, 0.5f), glm::vec2(0.5f, 1.0f), direction::DOWN_RIGHT);
-		} else {
-			if(river_u) {
-				add_line_helper(glm::vec2(0.5f, 0.0f), glm::vec2(0.5f, 0.5f), direction::UP);
-			}
-			if(river_d) {
-				add_line_helper(glm::vec2(0.5f, 0.5f), glm::vec2(0.5f, 1.0f), direction::DOWN);
-			}
-			if(river_l) {
-				add_line_helper(glm::vec2(0.0f, 0.5f), glm::vec2(0.5f, 0.5f), direction::LEFT);
-			}
-			if(river_r) {
-				add_line_helper(glm::vec2(0.5f, 0.5f), glm::vec2(1.0f, 0.5f), direction::RIGHT);
+		int32_t const y_end = std::min(1 + (band_index + 1) * int32_t(border_band_height), size.y - 1);
+		for(int y = 1 + band_index * int32_t(border_band_height); y < y_end; y++) {
+			for(int x = 1; x < size.x - 1; x++) {
+				auto river_center = is_river(river_data[(x + 0) + (y + 0) * size.x]);
+				if(river_center) {
+					auto river_u = is_river(river_data[(x + 0) + (y - 1) * size.x]);
+					auto river_d = is_river(river_data[(x + 0) + (y + 1) * size.x]);
+					auto river_r = is_river(river_data[(x + 1) + (y + 0) * size.x]);
+					auto river_l = is_river(river_data[(x - 1) + (y + 0) * size.x]);
+					add_river(x, y, river_u, river_d, river_r, river_l);
+				}
 			}
-		}
-		};
 
-	for(int y = 1; y < size.y - 1; y++) {
-		for(int x = 1; x < size.x - 1; x++) {
-			auto river_center = is_river(river_data[(x + 0) + (y + 0) * size.x]);
-			if(river_center) {
-				auto river_u = is_river(river_data[(x + 0) + (y - 1) * size.x]);
-				auto river_d = is_river(river_data[(x + 0) + (y + 1) * size.x]);
-				auto river_r = is_river(river_data[(x + 1) + (y + 0) * size.x]);
-				auto river_l = is_river(river_data[(x - 1) + (y + 0) * size.x]);
-				add_river(x, y, river_u, river_d, river_r, river_l);
-			}
+			// Move the border_direction rows a step down
+			std::swap(last_row, current_row);
+			std::fill(current_row.begin(), current_row.end(), BorderDirection{});
 		}
+	});
 
-		// Move the border_direction rows a step down
-		std::swap(last_row, current_row);
-		std::fill(current_row.begin(), current_row.end(), BorderDirection{});
-	}
+	size_t total = 0;
+	for(auto& v : band_vertices)
+		total += v.size();
+	std::vector<border_vertex> river_vertices;
+	river_vertices.reserve(total);
+	for(auto& v : band_vertices)
+		river_vertices.insert(river_vertices.end(), v.begin(), v.end());
 	return river_vertices;
 }
 }
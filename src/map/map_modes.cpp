@@ -8,6 +8,18 @@
 #include "nations.hpp"
 #include <unordered_map>
 
+namespace map_mode {
+
+// The per province body of a map mode only reads the game state and writes the texels of that province, so
+// provinces are colored in parallel. Passes that accumulate across provinces (maximums and the like) stay serial.
+template<typename F>
+void for_each_province_parallel(sys::state& state, F&& func) {
+	concurrency::parallel_for(uint32_t(0), state.world.province_size(),
+			[&](uint32_t i) { func(dcon::province_id{dcon::province_id::value_base_t(i)}); });
+}
+
+} // namespace map_mode
+
 #include "modes/political.hpp"
 #include "modes/supply.hpp"
 #include "modes/region.hpp"
@@ -33,12 +45,23 @@
 namespace map_mode {
 
 void set_map_mode(sys::state& state, mode mode) {
+	if(mode == mode::terrain) {
+		state.map_state.set_terrain_map_mode();
+		return;
+	}
+	if(uint8_t(mode) >= MODE_COUNT)
+		return;
+
+	auto& cached = state.map_state.cached_map_modes[uint8_t(mode)];
+	auto selected_province = state.map_state.get_selected_province();
+	if(cached.valid && cached.selected_province == selected_province && cached.player_nation == state.local_player_nation) {
+		state.map_state.set_province_color(cached.province_colors, mode);
+		return;
+	}
+
 	std::vector<uint32_t> prov_color;
 
 	switch(mode) {
-	case mode::terrain:
-		state.map_state.set_terrain_map_mode();
-		return;
 	case mode::political:
 		prov_color = political_map_from(state);
 		break;
@@ -109,7 +132,11 @@ void set_map_mode(sys::state& state, mode mode) {
 	default:
 		return;
 	}
-	state.map_state.set_province_color(prov_color, mode);
+	cached.province_colors = std::move(prov_color);
+	cached.selected_province = selected_province;
+	cached.player_nation = state.local_player_nation;
+	cached.valid = true;
+	state.map_state.set_province_color(cached.province_colors, mode);
 }
 
 void update_map_mode(sys::state& state) {
@@ -118,4 +145,9 @@ void update_map_mode(sys::state& state) {
 	}
 	set_map_mode(state, state.map_state.active_map_mode);
 }
+
+void invalidate_map_modes(sys::state& state) {
+	for(auto& cached : state.map_state.cached_map_modes)
+		cached.valid = false;
+}
 } // namespace map_mode
@@ -30,7 +30,10 @@ enum class mode : uint8_t {
 };
 
 const uint8_t PROV_COLOR_LAYERS = 2;
+const uint8_t MODE_COUNT = uint8_t(mode::naval) + 1;
 
 void set_map_mode(sys::state& state, mode mode);
 void update_map_mode(sys::state& state);
+// forget the colors generated for every mode; called when the game state they were generated from has changed
+void invalidate_map_modes(sys::state& state);
 } // namespace map_mode
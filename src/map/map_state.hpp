@@ -3,6 +3,7 @@
 #include "map_modes.hpp"
 #include <glm/vec2.hpp>
 #include <glm/mat4x4.hpp>
+#include <array>
 #include "map.hpp"
 
 namespace sys {
@@ -15,6 +16,16 @@ struct scenario_building_context;
 namespace map {
 
 enum class map_view { globe, flat };
+
+// Province colors last generated for a map mode. They stay valid until the game state changes, which invalidates
+// every mode, or until the selected province or the player nation they were generated for changes.
+struct cached_map_mode {
+	std::vector<uint32_t> province_colors;
+	dcon::province_id selected_province;
+	dcon::nation_id player_nation;
+	bool valid = false;
+};
+
 class map_state {
 public:
 	map_state(){};
@@ -53,6 +64,7 @@ public:
 	void set_selected_province(dcon::province_id prov_id);
 
 	map_mode::mode active_map_mode = map_mode::mode::terrain;
+	std::array<cached_map_mode, map_mode::MODE_COUNT> cached_map_modes;
 	dcon::province_id selected_province = dcon::province_id{};
 
 	display_data map_data;
@@ -6,7 +6,7 @@ std::vector<uint32_t> civilization_level_map_from(sys::state& state) {
 
 	std::vector<uint32_t> prov_color(texture_size * 2);
 
-	state.world.for_each_province([&](dcon::province_id prov_id) {
+	map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 		auto nation = state.world.province_get_nation_from_province_ownership(prov_id);
 		auto status = nations::get_status(state, nation);
 
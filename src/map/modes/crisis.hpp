@@ -4,7 +4,7 @@ std::vector<uint32_t> crisis_map_from(sys::state& state) {
 	uint32_t texture_size = province_size + 256 - province_size % 256;
 
 	std::vector<uint32_t> prov_color(texture_size * 2);
-	state.world.for_each_province([&](dcon::province_id prov_id) {
+	map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 		auto fat_id = dcon::fatten(state.world, prov_id);
 		auto nation = fat_id.get_nation_from_province_ownership();
 		auto i = province::to_map_id(prov_id);
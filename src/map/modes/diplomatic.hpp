@@ -59,7 +59,7 @@ std::vector<uint32_t> get_selected_diplomatic_color(sys::state& state) {
 
 	auto selected_primary_culture = selected_nation.get_primary_culture();
 
-	state.world.for_each_province([&](dcon::province_id prov_id) {
+	map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 		auto fat_id = dcon::fatten(state.world, prov_id);
 		auto i = province::to_map_id(prov_id);
 		uint32_t color = 0x222222;
@@ -7,7 +7,7 @@ std::vector<uint32_t> infrastructure_map_from(sys::state& state) {
 	std::vector<uint32_t> prov_color(texture_size * 2);
 
 	int32_t max_rails_lvl = state.economy_definitions.building_definitions[int32_t(economy::province_building_type::railroad)].max_level;
-	state.world.for_each_province([&](dcon::province_id prov_id) {
+	map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 		auto nation = state.world.province_get_nation_from_province_ownership(prov_id);
 
 		int32_t current_rails_lvl = state.world.province_get_building_level(prov_id, economy::province_building_type::railroad);
@@ -5,7 +5,7 @@ std::vector<uint32_t> get_nationality_global_color(sys::state& state) {
 	uint32_t texture_size = province_size + 256 - province_size % 256;
 
 	std::vector<uint32_t> prov_color(texture_size * 2);
-	state.world.for_each_province([&](dcon::province_id prov_id) {
+	map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 		auto id = province::to_map_id(prov_id);
 		float total_pops = state.world.province_get_demographics(prov_id, demographics::total);
 
@@ -69,7 +69,7 @@ std::vector<uint32_t> get_nationality_diaspora_color(sys::state& state) {
 			empty_color = 0x222222;
 		}
 
-		state.world.for_each_province([&](dcon::province_id prov_id) {
+		map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 			auto i = province::to_map_id(prov_id);
 			auto fat_id = dcon::fatten(state.world, prov_id);
 			auto total_pop = state.world.province_get_demographics(prov_id, demographics::total);
@@ -28,7 +28,7 @@ std::vector<uint32_t> party_loyalty_map_from(sys::state& state) {
 
 	std::vector<uint32_t> prov_color(texture_size * 2);
 
-	state.world.for_each_province([&](dcon::province_id prov_id) {
+	map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 			auto parties_info = get_sorted_parties_info(state, prov_id);
 
 			auto i = province::to_map_id(prov_id);
@@ -18,11 +18,11 @@ std::vector<uint32_t> get_global_population_color(sys::state& state) {
 
 	std::vector<uint32_t> prov_color(texture_size * 2);
 
-	state.world.for_each_province([&](dcon::province_id prov_id) {
+	map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 		auto fat_id = dcon::fatten(state.world, prov_id);
 		auto cid = fat_id.get_continent().id.index();
 		auto i = province::to_map_id(prov_id);
-		float gradient_index = prov_population[i] / continent_max_pop[cid];
+		float gradient_index = prov_population[i] / continent_max_pop.at(cid);
 
 		auto color = ogl::color_gradient(gradient_index, 210, 100 << 8);
 		prov_color[i] = color;
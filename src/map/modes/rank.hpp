@@ -21,7 +21,7 @@ std::vector<uint32_t> rank_map_from(sys::state& state) {
 		}
 	}
 
-	state.world.for_each_province([&](dcon::province_id prov_id) {
+	map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 		auto fat_id = dcon::fatten(state.world, prov_id);
 
 		auto nation_id = fat_id.get_nation_from_province_ownership();
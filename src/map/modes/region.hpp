@@ -6,7 +6,7 @@ std::vector<uint32_t> region_map_from(sys::state& state) {
 
 	std::vector<uint32_t> prov_color(texture_size * 2);
 
-	state.world.for_each_province([&](dcon::province_id prov_id) {
+	map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 		auto fat_id = dcon::fatten(state.world, prov_id);
 		auto id = fat_id.get_abstract_state_membership();
 		uint32_t color = ogl::color_from_hash(id.get_state().id.index());
@@ -16,7 +16,7 @@ std::vector<uint32_t> relation_map_from(sys::state& state) {
 
 	auto relations = selected_nation.get_diplomatic_relation_as_related_nations();
 
-	state.world.for_each_province([&](dcon::province_id prov_id) {
+	map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 		auto other_nation = state.world.province_get_nation_from_province_ownership(prov_id);
 
 		// if the province has no owners
@@ -20,7 +20,7 @@ std::vector<uint32_t> rgo_output_map_from(sys::state& state) {
 			}
 		});
 
-		state.world.for_each_province([&](dcon::province_id prov_id) {
+		map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 			auto prov_rgo = state.world.province_get_rgo(prov_id);
 
 			if(searched_rgo == prov_rgo) {
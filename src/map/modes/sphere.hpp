@@ -7,7 +7,7 @@ std::vector<uint32_t> get_global_sphere_color(sys::state& state) {
 
 	std::vector<uint32_t> prov_color(texture_size * 2);
 
-	state.world.for_each_province([&](dcon::province_id prov_id) {
+	map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 		auto fat_id = dcon::fatten(state.world, prov_id);
 		auto i = province::to_map_id(prov_id);
 
@@ -71,7 +71,7 @@ std::vector<uint32_t> get_selected_sphere_color(sys::state& state) {
 
 	// Paint only sphere countries
 	if(bool(master)) {
-		state.world.for_each_province([&](dcon::province_id prov_id) {
+		map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 			auto fat_id = dcon::fatten(state.world, prov_id);
 			auto i = province::to_map_id(prov_id);
 
@@ -117,7 +117,7 @@ std::vector<uint32_t> get_selected_sphere_color(sys::state& state) {
 			prov_color[i + texture_size] = stripe_color;
 		});
 	} else { // Paint selected country and influencers
-		state.world.for_each_province([&](dcon::province_id prov_id) {
+		map_mode::for_each_province_parallel(state, [&](dcon::province_id prov_id) {
 			auto fat_id = dcon::fatten(state.world, prov_id);
 			auto i = province::to_map_id(prov_id);
 
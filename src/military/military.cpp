@@ -3139,6 +3139,152 @@ void run_gc(sys::state& state) {
 	}
 }
 
+/*
+* Compaction: regiments and ships are created and destroyed constantly, and the erasable dcon storage never shrinks
+* below the highest live index. To pack them, we first exhaust the free list (so that every index below size_used is
+* occupied), then move each live object that sits above the live count into one of the freshly created slots below it,
+* and finally delete everything above the live count from the top down (which lets size_used shrink back).
+* The remap table is returned so that any stored ids (battle lines, reserves, ship slots) can be patched.
+*/
+template<typename T, typename C, typename M, typename D>
+bool compact_erasable(uint32_t used, std::vector<T>& remap, C&& create, M&& move, D&& destroy, std::vector<uint8_t> const& is_live) {
+	uint32_t live = 0;
+	for(uint32_t i = 0; i < used; ++i)
+		live += is_live[i];
+	if(live == used)
+		return false;
+
+	remap.resize(used);
+	for(uint32_t i = 0; i < used; ++i)
+		remap[i] = T{ typename T::value_base_t(i) };
+
+	static std::vector<T> fresh;
+	fresh.clear();
+	for(uint32_t i = live; i < used; ++i) {
+		auto f = create();
+		assert(f.index() < int32_t(used)); // new objects must come from the free list
+		fresh.push_back(f);
+	}
+	std::sort(fresh.begin(), fresh.end(), [](T a, T b) { return a.index() < b.index(); });
+
+	uint32_t next_fresh = 0;
+	for(uint32_t i = live; i < used; ++i) {
+		if(is_live[i]) {
+			assert(next_fresh < fresh.size() && fresh[next_fresh].index() < int32_t(live));
+			T to = fresh[next_fresh];
+			++next_fresh;
+			move(T{ typename T::value_base_t(i) }, to);
+			remap[i] = to;
+		}
+	}
+	for(uint32_t i = used; i-- > live; ) {
+		destroy(T{ typename T::value_base_t(i) });
+	}
+	return true;
+}
+
+bool compact_units(sys::state& state) {
+	auto threshold = state.defines.alice_unit_compaction_threshold;
+	if(threshold <= 0.0f)
+		return false;
+
+	bool moved_any = false;
+
+	std::vector<uint8_t> is_live;
+
+	//
+	// regiments
+	//
+	{
+		uint32_t used = state.world.regiment_size();
+		uint32_t live = 0;
+		is_live.assign(used, uint8_t(0));
+		for(auto r : state.world.in_regiment) {
+			is_live[r.id.index()] = uint8_t(1);
+			++live;
+		}
+		std::vector<dcon::regiment_id> reg_remap;
+		if(used != 0 && float(live) < float(used) * threshold) {
+			bool moved = compact_erasable(used, reg_remap,
+				[&]() { return state.world.create_regiment(); },
+				[&](dcon::regiment_id from, dcon::regiment_id to) {
+					state.world.regiment_set_name(to, state.world.regiment_get_name(from));
+					state.world.regiment_set_type(to, state.world.regiment_get_type(from));
+					state.world.regiment_set_strength(to, state.world.regiment_get_strength(from));
+					state.world.regiment_set_pending_damage(to, state.world.regiment_get_pending_damage(from));
+					state.world.regiment_set_org(to, state.world.regiment_get_org(from));
+					state.world.regiment_set_pending_split(to, state.world.regiment_get_pending_split(from));
+					state.world.regiment_set_army_from_army_membership(to, state.world.regiment_get_army_from_army_membership(from));
+					state.world.regiment_set_pop_from_regiment_source(to, state.world.regiment_get_pop_from_regiment_source(from));
+				},
+				[&](dcon::regiment_id r) { state.world.delete_regiment(r); },
+				is_live);
+
+			if(moved) {
+				auto patch = [&](dcon::regiment_id& r) {
+					if(r && uint32_t(r.index()) < reg_remap.size())
+						r = reg_remap[r.index()];
+				};
+				for(auto b : state.world.in_land_battle) {
+					for(auto& r : state.world.land_battle_get_attacker_back_line(b))
+						patch(r);
+					for(auto& r : state.world.land_battle_get_attacker_front_line(b))
+						patch(r);
+					for(auto& r : state.world.land_battle_get_defender_back_line(b))
+						patch(r);
+					for(auto& r : state.world.land_battle_get_defender_front_line(b))
+						patch(r);
+					auto reserves = state.world.land_battle_get_reserves(b);
+					for(uint32_t j = 0; j < reserves.size(); ++j)
+						patch(reserves[j].regiment);
+				}
+				moved_any = true;
+			}
+		}
+	}
+
+	//
+	// ships
+	//
+	{
+		uint32_t used = state.world.ship_size();
+		uint32_t live = 0;
+		is_live.assign(used, uint8_t(0));
+		for(auto s : state.world.in_ship) {
+			is_live[s.id.index()] = uint8_t(1);
+			++live;
+		}
+		std::vector<dcon::ship_id> ship_remap;
+		if(used != 0 && float(live) < float(used) * threshold) {
+			bool moved = compact_erasable(used, ship_remap,
+				[&]() { return state.world.create_ship(); },
+				[&](dcon::ship_id from, dcon::ship_id to) {
+					state.world.ship_set_name(to, state.world.ship_get_name(from));
+					state.world.ship_set_type(to, state.world.ship_get_type(from));
+					state.world.ship_set_strength(to, state.world.ship_get_strength(from));
+					state.world.ship_set_org(to, state.world.ship_get_org(from));
+					state.world.ship_set_pending_split(to, state.world.ship_get_pending_split(from));
+					state.world.ship_set_navy_from_navy_membership(to, state.world.ship_get_navy_from_navy_membership(from));
+				},
+				[&](dcon::ship_id s) { state.world.delete_ship(s); },
+				is_live);
+
+			if(moved) {
+				for(auto b : state.world.in_naval_battle) {
+					auto slots = state.world.naval_battle_get_slots(b);
+					for(uint32_t j = 0; j < slots.size(); ++j) {
+						if(slots[j].ship && uint32_t(slots[j].ship.index()) < ship_remap.size())
+							slots[j].ship = ship_remap[slots[j].ship.index()];
+					}
+				}
+				moved_any = true;
+			}
+		}
+	}
+
+	return moved_any;
+}
+
 void add_truce_between_sides(sys::state& state, dcon::war_id w, int32_t months) {
 	auto wpar = state.world.war_get_war_participant(w);
 	auto num_par = int32_t(wpar.end() - wpar.begin());
@@ -6639,8 +6785,8 @@ void start_mobilization(sys::state& state, dcon::nation_id n) {
 
 	std::sort(schedule_array.begin(), schedule_array.end(),
 			[&, cap = state.world.nation_get_capital(n)](mobilization_order const& a, mobilization_order const& b) {
-				auto a_dist = province::direct_distance(state, a.where, cap);
-				auto b_dist = province::direct_distance(state, b.where, cap);
+				auto a_dist = province::sorting_distance(state, a.where, cap);
+				auto b_dist = province::sorting_distance(state, b.where, cap);
 				if(a_dist != b_dist)
 					return a_dist > b_dist;
 				return a.where.value < b.where.value;
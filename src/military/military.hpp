@@ -412,6 +412,9 @@ void recover_org(sys::state& state);
 void reinforce_regiments(sys::state& state);
 void repair_ships(sys::state& state);
 void run_gc(sys::state& state);
+// packs regiments and ships into a dense prefix of their arrays when fewer than alice_unit_compaction_threshold of the used slots are
+// live (a threshold of 0, the default, disables it); this renumbers regiments and ships, so it only runs while a save is loaded
+bool compact_units(sys::state& state);
 void update_blackflag_status(sys::state& state);
 void send_rebel_hunter_to_next_province(sys::state& state, dcon::army_id ar, dcon::province_id prov);
 
@@ -2755,7 +2755,7 @@ float get_yesterday_income(sys::state& state, dcon::nation_id n) {
 	sum += economy::estimate_tax_income_by_strata(state, n, culture::pop_strata::poor);
 	sum += economy::estimate_tax_income_by_strata(state, n, culture::pop_strata::middle);
 	sum += economy::estimate_tax_income_by_strata(state, n, culture::pop_strata::rich);
-	sum += economy::estimate_gold_income(state, n);
+	sum += state.world.nation_get_estimated_gold_income(n);
 	return sum;
 }
 
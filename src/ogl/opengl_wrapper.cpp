@@ -119,7 +119,8 @@ void initialize_opengl(sys::state& state) {
 	state.map_state.load_map(state);
 
 	load_special_icons(state);
-	state.font_collection.load_all_glyphs();
+	preload_flag_textures(state);
+	// glyphs are rendered into the font textures the first time they are drawn (see font::make_glyph)
 }
 
 GLint compile_shader(std::string_view source, GLenum type) {
@@ -270,6 +271,9 @@ void load_global_squares(sys::state& state) {
 
 		glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 16, global_sub_square_data, GL_STATIC_DRAW);
 	}
+
+	glGenBuffers(1, &state.open_gl.text_batch_buffer);
+	glGenBuffers(1, &state.open_gl.sprite_batch_buffer);
 }
 
 inline auto map_color_modification_to_index(color_modification e) {
@@ -309,25 +313,53 @@ void bind_vertices_by_rotation(sys::state const& state, ui::rotation r, bool fli
 	}
 }
 
-void render_textured_rect(sys::state const& state, color_modification enabled, float x, float y, float width, float height,
-		GLuint texture_handle, ui::rotation r, bool flipped) {
-	glBindVertexArray(state.open_gl.global_square_vao);
+GLfloat const* square_data_by_rotation(ui::rotation r, bool flipped) {
+	switch(r) {
+	case ui::rotation::r90_left:
+		return flipped ? global_square_left_flipped_data : global_square_left_data;
+	case ui::rotation::r90_right:
+		return flipped ? global_square_right_flipped_data : global_square_right_data;
+	case ui::rotation::upright:
+	default:
+		return flipped ? global_square_flipped_data : global_square_data;
+	}
+}
 
-	bind_vertices_by_rotation(state, r, flipped);
+void flush_sprite_batch(sys::state const& state) {
+	auto& batch = state.open_gl.sprites;
+	if(batch.vertices.empty())
+		return;
 
-	glUniform4f(parameters::drawing_rectangle, x, y, width, height);
-	// glUniform4f(parameters::drawing_rectangle, 0, 0, width, height);
+	glBindVertexArray(state.open_gl.global_square_vao);
+	glBindBuffer(GL_ARRAY_BUFFER, state.open_gl.sprite_batch_buffer);
+	glBufferData(GL_ARRAY_BUFFER, GLsizeiptr(batch.vertices.size() * sizeof(glyph_vertex)), batch.vertices.data(), GL_STREAM_DRAW);
+	glBindVertexBuffer(0, state.open_gl.sprite_batch_buffer, 0, sizeof(glyph_vertex));
+
+	glUniform4f(parameters::drawing_rectangle, 0.0f, 0.0f, 1.0f, 1.0f);
 
 	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, texture_handle);
+	glBindTexture(GL_TEXTURE_2D, batch.texture);
 
-	GLuint subroutines[2] = {map_color_modification_to_index(enabled), parameters::no_filter};
+	GLuint subroutines[2] = {batch.color_subroutine, parameters::no_filter};
 	glUniformSubroutinesuiv(GL_FRAGMENT_SHADER, 2, subroutines); // must set all subroutines in one call
 
-	glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+	glDrawArrays(GL_TRIANGLES, 0, GLsizei(batch.vertices.size()));
+	batch.clear();
+}
+
+void render_textured_rect(sys::state const& state, color_modification enabled, float x, float y, float width, float height,
+		GLuint texture_handle, ui::rotation r, bool flipped) {
+	auto& batch = state.open_gl.sprites;
+	GLuint color = map_color_modification_to_index(enabled);
+	if(!batch.accepts(texture_handle, color))
+		flush_sprite_batch(state);
+	batch.texture = texture_handle;
+	batch.color_subroutine = color;
+	batch.add_quad(x, y, width, height, square_data_by_rotation(r, flipped));
 }
 
 void render_textured_rect_direct(sys::state const& state, float x, float y, float width, float height, uint32_t handle) {
+	flush_sprite_batch(state);
 	glBindVertexArray(state.open_gl.global_square_vao);
 
 	glBindVertexBuffer(0, state.open_gl.global_square_buffer, 0, sizeof(GLfloat) * 4);
@@ -345,6 +377,7 @@ void render_textured_rect_direct(sys::state const& state, float x, float y, floa
 
 void render_linegraph(sys::state const& state, color_modification enabled, float x, float y, float width, float height,
 		lines& l) {
+	flush_sprite_batch(state);
 	glBindVertexArray(state.open_gl.global_square_vao);
 
 	l.bind_buffer();
@@ -360,6 +393,7 @@ void render_linegraph(sys::state const& state, color_modification enabled, float
 
 void render_barchart(sys::state const& state, color_modification enabled, float x, float y, float width, float height,
 		data_texture& t, ui::rotation r, bool flipped) {
+	flush_sprite_batch(state);
 	glBindVertexArray(state.open_gl.global_square_vao);
 
 	bind_vertices_by_rotation(state, r, flipped);
@@ -376,6 +410,7 @@ void render_barchart(sys::state const& state, color_modification enabled, float
 }
 
 void render_piechart(sys::state const& state, color_modification enabled, float x, float y, float size, data_texture& t) {
+	flush_sprite_batch(state);
 	glBindVertexArray(state.open_gl.global_square_vao);
 
 	glBindVertexBuffer(0, state.open_gl.global_square_buffer, 0, sizeof(GLfloat) * 4);
@@ -393,6 +428,7 @@ void render_piechart(sys::state const& state, color_modification enabled, float
 
 void render_bordered_rect(sys::state const& state, color_modification enabled, float border_size, float x, float y, float width,
 		float height, GLuint texture_handle, ui::rotation r, bool flipped) {
+	flush_sprite_batch(state);
 	glBindVertexArray(state.open_gl.global_square_vao);
 
 	bind_vertices_by_rotation(state, r, flipped);
@@ -411,6 +447,7 @@ void render_bordered_rect(sys::state const& state, color_modification enabled, f
 
 void render_masked_rect(sys::state const& state, color_modification enabled, float x, float y, float width, float height,
 		GLuint texture_handle, GLuint mask_texture_handle, ui::rotation r, bool flipped) {
+	flush_sprite_batch(state);
 	glBindVertexArray(state.open_gl.global_square_vao);
 
 	bind_vertices_by_rotation(state, r, flipped);
@@ -430,6 +467,7 @@ void render_masked_rect(sys::state const& state, color_modification enabled, flo
 
 void render_progress_bar(sys::state const& state, color_modification enabled, float progress, float x, float y, float width,
 		float height, GLuint left_texture_handle, GLuint right_texture_handle, ui::rotation r, bool flipped) {
+	flush_sprite_batch(state);
 	glBindVertexArray(state.open_gl.global_square_vao);
 
 	bind_vertices_by_rotation(state, r, flipped);
@@ -450,6 +488,7 @@ void render_progress_bar(sys::state const& state, color_modification enabled, fl
 
 void render_tinted_textured_rect(sys::state const& state, float x, float y, float width, float height, float r, float g, float b,
 		GLuint texture_handle, ui::rotation rot, bool flipped) {
+	flush_sprite_batch(state);
 	glBindVertexArray(state.open_gl.global_square_vao);
 
 	bind_vertices_by_rotation(state, rot, flipped);
@@ -468,6 +507,7 @@ void render_tinted_textured_rect(sys::state const& state, float x, float y, floa
 
 void render_tinted_subsprite(sys::state const& state, int frame, int total_frames, float x, float y,
 		float width, float height, float r, float g, float b, GLuint texture_handle, ui::rotation rot, bool flipped) {
+	flush_sprite_batch(state);
 	glBindVertexArray(state.open_gl.global_square_vao);
 
 	bind_vertices_by_rotation(state, rot, flipped);
@@ -488,26 +528,22 @@ void render_tinted_subsprite(sys::state const& state, int frame, int total_frame
 
 void render_subsprite(sys::state const& state, color_modification enabled, int frame, int total_frames, float x, float y,
 		float width, float height, GLuint texture_handle, ui::rotation r, bool flipped) {
-	glBindVertexArray(state.open_gl.global_square_vao);
-
-	bind_vertices_by_rotation(state, r, flipped);
-
+	auto& batch = state.open_gl.sprites;
+	GLuint color = map_color_modification_to_index(enabled);
+	if(!batch.accepts(texture_handle, color))
+		flush_sprite_batch(state);
+	batch.texture = texture_handle;
+	batch.color_subroutine = color;
+
+	// the frame is selected through the texture coordinates rather than the sub_sprite shader function
 	auto const scale = 1.0f / static_cast<float>(total_frames);
-	glUniform3f(parameters::inner_color, static_cast<float>(frame) * scale, scale, 0.0f);
-	glUniform4f(parameters::drawing_rectangle, x, y, width, height);
-
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, texture_handle);
-
-	GLuint subroutines[2] = {map_color_modification_to_index(enabled), parameters::sub_sprite};
-	glUniformSubroutinesuiv(GL_FRAGMENT_SHADER, 2, subroutines); // must set all subroutines in one call
-
-	glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+	batch.add_quad(x, y, width, height, square_data_by_rotation(r, flipped), scale, static_cast<float>(frame) * scale);
 }
 
 void render_character(sys::state const& state, char codepoint, color_modification enabled, float x, float y, float size, text::font& f) {
+	flush_sprite_batch(state);
 	if(text::win1250toUTF16(codepoint) != ' ') {
-		// f.make_glyph(codepoint);
+		f.make_glyph(codepoint);
 
 		glBindVertexBuffer(0, state.open_gl.sub_square_buffers[uint8_t(codepoint) & 63], 0, sizeof(GLfloat) * 4);
 		glActiveTexture(GL_TEXTURE0);
@@ -564,11 +600,28 @@ bool display_tag_is_valid(sys::state& state, char tag[3]) {
 	return bool(ident);
 }
 
+void flush_text_batch(sys::state& state, text_batch& batch, uint32_t const* page_textures) {
+	glUniform4f(parameters::drawing_rectangle, 0.0f, 0.0f, 1.0f, 1.0f);
+	glActiveTexture(GL_TEXTURE0);
+	glBindBuffer(GL_ARRAY_BUFFER, state.open_gl.text_batch_buffer);
+	for(uint32_t i = 0; i < text_batch::page_count; ++i) {
+		auto& page = batch.pages[i];
+		if(page.empty())
+			continue;
+		glBufferData(GL_ARRAY_BUFFER, GLsizeiptr(page.size() * sizeof(glyph_vertex)), page.data(), GL_STREAM_DRAW);
+		glBindVertexBuffer(0, state.open_gl.text_batch_buffer, 0, sizeof(glyph_vertex));
+		glBindTexture(GL_TEXTURE_2D, page_textures[i]);
+		glDrawArrays(GL_TRIANGLES, 0, GLsizei(page.size()));
+	}
+	batch.clear();
+}
+
 void internal_text_render(sys::state& state, char const* codepoints, uint32_t count, float x, float baseline_y, float size,
 		text::font& f, GLuint const* subroutines, GLuint const* icon_subroutines) {
+	f.make_glyph(char(0x4D)); // inline icons are aligned to the position of M
 	for(uint32_t i = 0; i < count; ++i) {
 		if(text::win1250toUTF16(codepoints[i]) != ' ') {
-			// f.make_glyph(codepoints[i]);
+			f.make_glyph(codepoints[i]);
 			if(text::win1250toUTF16(codepoints[i]) == u'\u0040') {
 				char tag[3] = { 0, 0, 0 };
 				tag[0] = (i + 1 < count) ? char(codepoints[i + 1]) : 0;
@@ -619,12 +672,8 @@ void internal_text_render(sys::state& state, char const* codepoints, uint32_t co
 
 				x += size;
 			} else {
-				glBindVertexBuffer(0, state.open_gl.sub_square_buffers[uint8_t(codepoints[i]) & 63], 0, sizeof(GLfloat) * 4);
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_2D, f.textures[uint8_t(codepoints[i]) >> 6]);
-				glUniform4f(parameters::drawing_rectangle, x + f.glyph_positions[uint8_t(codepoints[i])].x * size / 64.0f,
-						baseline_y + f.glyph_positions[uint8_t(codepoints[i])].y * size / 64.0f, size, size);
-				glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+				state.open_gl.glyph_batch.add_glyph(uint8_t(codepoints[i]), x + f.glyph_positions[uint8_t(codepoints[i])].x * size / 64.0f,
+						baseline_y + f.glyph_positions[uint8_t(codepoints[i])].y * size / 64.0f, size);
 
 				x += f.glyph_advances[uint8_t(codepoints[i])] * size / 64.0f +
 						 ((i != count - 1) ? f.kerning(codepoints[i], codepoints[i + 1]) * size / 64.0f : 0.0f);
@@ -634,6 +683,10 @@ void internal_text_render(sys::state& state, char const* codepoints, uint32_t co
 					 ((i != count - 1) ? f.kerning(codepoints[i], codepoints[i + 1]) * size / 64.0f : 0.0f);
 		}
 	}
+	if(!state.open_gl.glyph_batch.empty()) {
+		flush_text_batch(state, state.open_gl.glyph_batch, f.textures);
+		bind_vertices_by_rotation(state, ui::rotation::upright, false);
+	}
 }
 
 void render_new_text(sys::state& state, char const* codepoints, uint32_t count, color_modification enabled, float x,
@@ -735,13 +788,10 @@ void render_classic_text(sys::state& state, float x, float y, char const* codepo
 			f = font.chars[uint8_t(codepoints[i])];
 			float CurX = x + f.x_offset;
 			float CurY = y + f.y_offset;
-			glUniform4f(ogl::parameters::drawing_rectangle, CurX, CurY, float(f.width), float(f.height));
-			glUniform3f(parameters::inner_color, c.r, c.g, c.b);
-			glUniform4f(ogl::parameters::subrect, float(f.x) / float(font.width) /* x offset */,
-					float(f.width) / float(font.width) /* x width */, float(f.y) / float(font.width) /* y offset */,
-					float(f.height) / float(font.width) /* y height */
-			);
-			glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+			// bitmap fonts are a single square texture: the batch carries the exact texture coordinates
+			state.open_gl.glyph_batch.add_quad(0, CurX, CurY, float(f.width), float(f.height),
+					float(f.x) / float(font.width), float(f.y) / float(font.width),
+					float(f.x + f.width) / float(font.width), float(f.y + f.height) / float(font.width));
 		}
 
 		// Only check kerning if there is greater then 1 character and
@@ -751,10 +801,18 @@ void render_classic_text(sys::state& state, float x, float y, char const* codepo
 		}
 		x += f.x_advance;
 	}
+	if(!state.open_gl.glyph_batch.empty()) {
+		uint32_t const pages[text_batch::page_count] = {font.ftexid, 0, 0, 0};
+		glUniform3f(parameters::inner_color, c.r, c.g, c.b);
+		glUniform4f(ogl::parameters::subrect, 0.0f, 1.0f, 0.0f, 1.0f);
+		flush_text_batch(state, state.open_gl.glyph_batch, pages);
+		bind_vertices_by_rotation(state, ui::rotation::upright, false);
+	}
 }
 
 void render_text(sys::state& state, char const* codepoints, uint32_t count, color_modification enabled, float x, float y,
 		color3f const& c, uint16_t font_id) {
+	flush_sprite_batch(state);
 	if(state.user_settings.use_classic_fonts) {
 		render_classic_text(state, x, y, codepoints, count, enabled, c, text::get_bm_font(state, font_id));
 	} else {
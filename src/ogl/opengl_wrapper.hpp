@@ -11,6 +11,7 @@
 #include "container_types.hpp"
 #include "texture.hpp"
 #include "fonts.hpp"
+#include "text_batch.hpp"
 
 namespace ogl {
 namespace parameters {
@@ -157,6 +158,10 @@ struct data {
 	GLuint global_square_left_flipped_buffer = 0;
 
 	GLuint sub_square_buffers[64] = {0};
+	GLuint text_batch_buffer = 0;
+	GLuint sprite_batch_buffer = 0;
+	text_batch glyph_batch;
+	mutable sprite_batch sprites; // pending sprites, drawn by flush_sprite_batch
 
 	GLuint money_icon_tex = 0;
 	GLuint cross_icon_tex = 0;
@@ -212,6 +217,8 @@ public:
 	void bind_buffer();
 };
 
+// draws any sprites still waiting in the sprite batch; must be called before drawing outside of these functions
+void flush_sprite_batch(sys::state const& state);
 void render_textured_rect(sys::state const& state, color_modification enabled, float x, float y, float width, float height,
 		GLuint texture_handle, ui::rotation r, bool flipped);
 void render_textured_rect_direct(sys::state const& state, float x, float y, float width, float height, uint32_t handle);
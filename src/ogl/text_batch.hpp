@@ -0,0 +1,85 @@
+#pragma once
+
+#include <array>
+#include <stdint.h>
+#include <vector>
+
+namespace ogl {
+
+// Same position / texture coordinate layout as the ui square buffers. Positions are in screen space,
+// so a batch is drawn with a unit drawing rectangle.
+struct glyph_vertex {
+	float x = 0.0f;
+	float y = 0.0f;
+	float u = 0.0f;
+	float v = 0.0f;
+};
+
+// Collects the glyph quads of a string as triangle lists, one list per font texture page, so that a whole
+// string costs one draw call per page rather than one per glyph.
+struct text_batch {
+	static constexpr uint32_t page_count = 4; // outline fonts store 64 glyphs per texture
+
+	std::array<std::vector<glyph_vertex>, page_count> pages;
+
+	void clear() {
+		for(auto& p : pages)
+			p.clear();
+	}
+	bool empty() const {
+		for(auto& p : pages) {
+			if(!p.empty())
+				return false;
+		}
+		return true;
+	}
+
+	void add_quad(uint32_t page, float x, float y, float width, float height, float u0, float v0, float u1, float v1) {
+		auto& p = pages[page];
+		p.push_back(glyph_vertex{x, y, u0, v0});
+		p.push_back(glyph_vertex{x, y + height, u0, v1});
+		p.push_back(glyph_vertex{x + width, y + height, u1, v1});
+		p.push_back(glyph_vertex{x, y, u0, v0});
+		p.push_back(glyph_vertex{x + width, y + height, u1, v1});
+		p.push_back(glyph_vertex{x + width, y, u1, v0});
+	}
+	// an outline font glyph lives in cell (codepoint & 63) of an 8x8 grid on texture page (codepoint >> 6)
+	void add_glyph(uint8_t codepoint, float x, float y, float size) {
+		float const cell_x = float(codepoint & 7) / 8.0f;
+		float const cell_y = float((codepoint >> 3) & 7) / 8.0f;
+		add_quad(uint32_t(codepoint >> 6), x, y, size, size, cell_x, cell_y, cell_x + 1.0f / 8.0f, cell_y + 1.0f / 8.0f);
+	}
+};
+
+// Consecutive plain sprites (textured rects and subsprites) that share a texture and color modification are
+// collected here and drawn together as soon as something else needs to be drawn. Merging only consecutive
+// sprites keeps the painter's order of the element tree intact.
+struct sprite_batch {
+	std::vector<glyph_vertex> vertices;
+	uint32_t texture = 0;
+	uint32_t color_subroutine = 0;
+
+	bool accepts(uint32_t tex, uint32_t color) const {
+		return vertices.empty() || (texture == tex && color_subroutine == color);
+	}
+	void clear() {
+		vertices.clear();
+	}
+	// square holds four (x, y, u, v) corners in triangle fan order, as in the ui square buffers; u is remapped to
+	// u * u_scale + u_offset to select a frame of a subsprite strip
+	void add_quad(float x, float y, float width, float height, float const* square, float u_scale = 1.0f, float u_offset = 0.0f) {
+		glyph_vertex c[4];
+		for(uint32_t i = 0; i < 4; ++i) {
+			c[i] = glyph_vertex{x + square[i * 4] * width, y + square[i * 4 + 1] * height, square[i * 4 + 2] * u_scale + u_offset,
+					square[i * 4 + 3]};
+		}
+		vertices.push_back(c[0]);
+		vertices.push_back(c[1]);
+		vertices.push_back(c[2]);
+		vertices.push_back(c[0]);
+		vertices.push_back(c[2]);
+		vertices.push_back(c[3]);
+	}
+};
+
+} // namespace ogl
@@ -378,159 +378,228 @@ GLuint load_file_and_return_handle(native_string const& native_name, simple_fs::
 		}
 	}
 
-	auto file = open_file(root, native_name);
+	auto image = decode_image(native_name, fs);
+	if(image.found) {
+		upload_decoded_image(asset_texture, image, keep_data);
+		return asset_texture.texture_handle;
+	}
+	asset_texture.loaded = true; // because we tried to load it (and failed) and trying again will be wasteful
+	return 0;
+}
+
+decoded_image decode_image(native_string const& native_name, simple_fs::file_system const& fs) {
+	decoded_image result;
+	auto file = open_file(get_root(fs), native_name);
 	if(file) {
 		auto content = simple_fs::view_contents(*file);
 
 		int32_t file_channels = 4;
+		result.data = stbi_load_from_memory(reinterpret_cast<uint8_t const*>(content.data), int32_t(content.file_size),
+				&(result.size_x), &(result.size_y), &file_channels, 4);
+		result.found = true;
+	}
+	return result;
+}
 
-		asset_texture.data = stbi_load_from_memory(reinterpret_cast<uint8_t const*>(content.data), int32_t(content.file_size),
-				&(asset_texture.size_x), &(asset_texture.size_y), &file_channels, 4);
-
-		asset_texture.channels = 4;
-		asset_texture.loaded = true;
+void upload_decoded_image(texture& asset_texture, decoded_image& image, bool keep_data) {
+	asset_texture.data = image.data;
+	asset_texture.size_x = image.size_x;
+	asset_texture.size_y = image.size_y;
+	image.data = nullptr;
 
-		glGenTextures(1, &asset_texture.texture_handle);
-		if(asset_texture.texture_handle) {
-			glBindTexture(GL_TEXTURE_2D, asset_texture.texture_handle);
+	asset_texture.channels = 4;
+	asset_texture.loaded = true;
 
-			glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, asset_texture.size_x, asset_texture.size_y);
-			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, asset_texture.size_x, asset_texture.size_y, GL_RGBA, GL_UNSIGNED_BYTE,
-					asset_texture.data);
+	glGenTextures(1, &asset_texture.texture_handle);
+	if(asset_texture.texture_handle) {
+		glBindTexture(GL_TEXTURE_2D, asset_texture.texture_handle);
 
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, asset_texture.size_x, asset_texture.size_y);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, asset_texture.size_x, asset_texture.size_y, GL_RGBA, GL_UNSIGNED_BYTE,
+				asset_texture.data);
 
-			glBindTexture(GL_TEXTURE_2D, 0);
-		}
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-		if(!keep_data) {
-			STBI_FREE(asset_texture.data);
-			asset_texture.data = nullptr;
-		}
+		glBindTexture(GL_TEXTURE_2D, 0);
+	}
 
-		return asset_texture.texture_handle;
+	if(!keep_data) {
+		STBI_FREE(asset_texture.data);
+		asset_texture.data = nullptr;
 	}
-	asset_texture.loaded = true; // because we tried to load it (and failed) and trying again will be wasteful
-	return 0;
 }
 
-GLuint get_flag_handle(sys::state& state, dcon::national_identity_id nat_id, culture::flag_type type) {
+dcon::texture_id flag_texture_id(sys::state const& state, dcon::national_identity_id nat_id, culture::flag_type type) {
 	auto const offset = culture::get_remapped_flag_type(state, type);
-	dcon::texture_id id = dcon::texture_id{
+	return dcon::texture_id{
 			dcon::texture_id::value_base_t(state.ui_defs.textures.size() + (1 + nat_id.index()) * state.flag_types.size() + offset)};
+}
+
+native_string flag_file_name(sys::state const& state, dcon::national_identity_id nat_id, culture::flag_type type) {
+	native_string file_str;
+	file_str += NATIVE("gfx");
+	file_str += NATIVE_DIR_SEPARATOR;
+	file_str += NATIVE("flags");
+	file_str += NATIVE_DIR_SEPARATOR;
+	file_str += simple_fs::win1250_to_native(nations::int_to_tag(state.world.national_identity_get_identifying_int(nat_id)));
+	switch(type) {
+	case culture::flag_type::communist:
+		file_str += NATIVE("_communist");
+		break;
+	case culture::flag_type::count:
+	case culture::flag_type::default_flag:
+		break;
+	case culture::flag_type::fascist:
+		file_str += NATIVE("_fascist");
+		break;
+	case culture::flag_type::monarchy:
+		file_str += NATIVE("_monarchy");
+		break;
+	case culture::flag_type::republic:
+		file_str += NATIVE("_republic");
+		break;
+	// Non-vanilla
+	case culture::flag_type::theocracy:
+		file_str += NATIVE("_theocracy");
+		break;
+	case culture::flag_type::special:
+		file_str += NATIVE("_special");
+		break;
+	case culture::flag_type::spare:
+		file_str += NATIVE("_spare");
+		break;
+	case culture::flag_type::populist:
+		file_str += NATIVE("_populist");
+		break;
+	case culture::flag_type::realm:
+		file_str += NATIVE("_realm");
+		break;
+	case culture::flag_type::other:
+		file_str += NATIVE("_other");
+		break;
+	case culture::flag_type::monarchy2:
+		file_str += NATIVE("_monarchy2");
+		break;
+	case culture::flag_type::monarchy3:
+		file_str += NATIVE("_monarchy3");
+		break;
+	case culture::flag_type::republic2:
+		file_str += NATIVE("_republic2");
+		break;
+	case culture::flag_type::republic3:
+		file_str += NATIVE("_republic3");
+		break;
+	case culture::flag_type::communist2:
+		file_str += NATIVE("_communist2");
+		break;
+	case culture::flag_type::communist3:
+		file_str += NATIVE("_communist3");
+		break;
+	case culture::flag_type::fascist2:
+		file_str += NATIVE("_fascist2");
+		break;
+	case culture::flag_type::fascist3:
+		file_str += NATIVE("_fascist3");
+		break;
+	case culture::flag_type::theocracy2:
+		file_str += NATIVE("_theocracy2");
+		break;
+	case culture::flag_type::theocracy3:
+		file_str += NATIVE("_theocracy3");
+		break;
+	case culture::flag_type::cosmetic_1:
+		file_str += NATIVE("_cosmetic_1");
+		break;
+	case culture::flag_type::cosmetic_2:
+		file_str += NATIVE("_cosmetic_2");
+		break;
+	case culture::flag_type::colonial:
+		file_str += NATIVE("_colonial");
+		break;
+	case culture::flag_type::nationalist:
+		file_str += NATIVE("_nationalist");
+		break;
+	case culture::flag_type::sectarian:
+		file_str += NATIVE("_sectarian");
+		break;
+	case culture::flag_type::socialist:
+		file_str += NATIVE("_socialist");
+		break;
+	case culture::flag_type::dominion:
+		file_str += NATIVE("_dominion");
+		break;
+	case culture::flag_type::agrarism:
+		file_str += NATIVE("_agrarism");
+		break;
+	case culture::flag_type::national_syndicalist:
+		file_str += NATIVE("_national_syndicalist");
+		break;
+	case culture::flag_type::theocratic:
+		file_str += NATIVE("_theocratic");
+		break;
+	}
+	file_str += NATIVE(".tga");
+	return file_str;
+}
+
+GLuint get_flag_handle(sys::state& state, dcon::national_identity_id nat_id, culture::flag_type type) {
+	auto const id = flag_texture_id(state, nat_id, type);
 
 	if(state.open_gl.asset_textures[id].loaded) {
 		return state.open_gl.asset_textures[id].texture_handle;
 	} else { // load from file
+		return load_file_and_return_handle(flag_file_name(state, nat_id, type), state.common_fs, state.open_gl.asset_textures[id], false);
+	}
+}
 
-		native_string file_str;
-		file_str += NATIVE("gfx");
-		file_str += NATIVE_DIR_SEPARATOR;
-		file_str += NATIVE("flags");
-		file_str += NATIVE_DIR_SEPARATOR;
-		file_str += simple_fs::win1250_to_native(nations::int_to_tag(state.world.national_identity_get_identifying_int(nat_id)));
-		switch(type) {
-		case culture::flag_type::communist:
-			file_str += NATIVE("_communist");
-			break;
-		case culture::flag_type::count:
-		case culture::flag_type::default_flag:
-			break;
-		case culture::flag_type::fascist:
-			file_str += NATIVE("_fascist");
-			break;
-		case culture::flag_type::monarchy:
-			file_str += NATIVE("_monarchy");
-			break;
-		case culture::flag_type::republic:
-			file_str += NATIVE("_republic");
-			break;
-		// Non-vanilla
-		case culture::flag_type::theocracy:
-			file_str += NATIVE("_theocracy");
-			break;
-		case culture::flag_type::special:
-			file_str += NATIVE("_special");
-			break;
-		case culture::flag_type::spare:
-			file_str += NATIVE("_spare");
-			break;
-		case culture::flag_type::populist:
-			file_str += NATIVE("_populist");
-			break;
-		case culture::flag_type::realm:
-			file_str += NATIVE("_realm");
-			break;
-		case culture::flag_type::other:
-			file_str += NATIVE("_other");
-			break;
-		case culture::flag_type::monarchy2:
-			file_str += NATIVE("_monarchy2");
-			break;
-		case culture::flag_type::monarchy3:
-			file_str += NATIVE("_monarchy3");
-			break;
-		case culture::flag_type::republic2:
-			file_str += NATIVE("_republic2");
-			break;
-		case culture::flag_type::republic3:
-			file_str += NATIVE("_republic3");
-			break;
-		case culture::flag_type::communist2:
-			file_str += NATIVE("_communist2");
-			break;
-		case culture::flag_type::communist3:
-			file_str += NATIVE("_communist3");
-			break;
-		case culture::flag_type::fascist2:
-			file_str += NATIVE("_fascist2");
-			break;
-		case culture::flag_type::fascist3:
-			file_str += NATIVE("_fascist3");
-			break;
-		case culture::flag_type::theocracy2:
-			file_str += NATIVE("_theocracy2");
-			break;
-		case culture::flag_type::theocracy3:
-			file_str += NATIVE("_theocracy3");
-			break;
-		case culture::flag_type::cosmetic_1:
-			file_str += NATIVE("_cosmetic_1");
-			break;
-		case culture::flag_type::cosmetic_2:
-			file_str += NATIVE("_cosmetic_2");
-			break;
-		case culture::flag_type::colonial:
-			file_str += NATIVE("_colonial");
-			break;
-		case culture::flag_type::nationalist:
-			file_str += NATIVE("_nationalist");
-			break;
-		case culture::flag_type::sectarian:
-			file_str += NATIVE("_sectarian");
-			break;
-		case culture::flag_type::socialist:
-			file_str += NATIVE("_socialist");
-			break;
-		case culture::flag_type::dominion:
-			file_str += NATIVE("_dominion");
-			break;
-		case culture::flag_type::agrarism:
-			file_str += NATIVE("_agrarism");
-			break;
-		case culture::flag_type::national_syndicalist:
-			file_str += NATIVE("_national_syndicalist");
-			break;
-		case culture::flag_type::theocratic:
-			file_str += NATIVE("_theocratic");
-			break;
-		}
-		file_str += NATIVE(".tga");
+void preload_flag_textures(sys::state& state) {
+	struct pending_flag {
+		dcon::texture_id id;
+		native_string file_name;
+		decoded_image image;
+		bool has_dds = false;
+	};
+	std::vector<pending_flag> pending;
+	for(auto n : state.world.in_nation) {
+		auto ident = n.get_identity_from_identity_holder().id;
+		if(!ident || n.get_owned_province_count() == 0)
+			continue;
+		auto const type = culture::get_current_flag_type(state, n.id);
+		auto const id = flag_texture_id(state, ident, type);
+		if(!state.open_gl.asset_textures[id].loaded)
+			pending.push_back(pending_flag{id, flag_file_name(state, ident, type), decoded_image{}, false});
+	}
 
-		return load_file_and_return_handle(file_str, state.common_fs, state.open_gl.asset_textures[id], false);
+	// decoding needs no opengl context, so it is spread over the worker threads; only the uploads happen here
+	auto root = get_root(state.common_fs);
+	concurrency::parallel_for(size_t(0), pending.size(), [&](size_t i) {
+		auto& p = pending[i];
+		auto const dds_name = p.file_name.substr(0, p.file_name.length() - 3) + NATIVE("dds");
+		if(simple_fs::peek_file(root, dds_name)) {
+			p.has_dds = true; // dds files are uploaded as they are by the synchronous path
+			return;
+		}
+		p.image = decode_image(p.file_name, state.common_fs);
+	});
+
+	for(auto& p : pending) {
+		auto& asset_texture = state.open_gl.asset_textures[p.id];
+		if(asset_texture.loaded)
+			continue; // two nations can share a flag
+		if(p.has_dds) {
+			load_file_and_return_handle(p.file_name, state.common_fs, asset_texture, false);
+		} else if(p.image.found) {
+			upload_decoded_image(asset_texture, p.image, false);
+		} else {
+			asset_texture.loaded = true;
+		}
+	}
+	for(auto& p : pending) {
+		if(p.image.data)
+			STBI_FREE(p.image.data);
 	}
 }
 
@@ -15,6 +15,20 @@ GLuint get_texture_handle(sys::state& state, dcon::texture_id id, bool keep_data
 GLuint get_flag_handle(sys::state& state, dcon::national_identity_id nat_id, culture::flag_type type);
 GLuint load_file_and_return_handle(native_string const& native_name, simple_fs::file_system const& fs, texture& asset_texture, bool keep_data);
 
+// An image decoded to RGBA8 in memory. Decoding does not touch opengl, so it may run on any thread and be timed without a
+// context; upload_decoded_image then creates the texture on the render thread and takes ownership of the pixels.
+struct decoded_image {
+	uint8_t* data = nullptr;
+	int32_t size_x = 0;
+	int32_t size_y = 0;
+	bool found = false;
+};
+decoded_image decode_image(native_string const& native_name, simple_fs::file_system const& fs);
+void upload_decoded_image(texture& asset_texture, decoded_image& image, bool keep_data);
+
+// decodes the current flags of all nations in parallel and uploads them, so that windows full of flags do not stall on first open
+void preload_flag_textures(sys::state& state);
+
 enum {
 	SOIL_FLAG_POWER_OF_TWO = 1,
 	SOIL_FLAG_MIPMAPS = 2,
@@ -61,6 +75,7 @@ public:
 	friend GLuint load_file_and_return_handle(native_string const& native_name, simple_fs::file_system const& fs,
 			texture& asset_texture, bool keep_data);
 	friend GLuint get_flag_handle(sys::state& state, dcon::national_identity_id nat_id, culture::flag_type type);
+	friend void upload_decoded_image(texture& asset_texture, decoded_image& image, bool keep_data);
 };
 
 class data_texture {
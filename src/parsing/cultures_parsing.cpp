@@ -360,7 +360,7 @@ void register_invention(std::string_view name, token_generator& gen, error_handl
 }
 
 void read_promotion_target(std::string_view name, token_generator& gen, error_handler& err, poptype_context& context) {
-	if(auto it = context.outer_context.map_of_poptypes.find(std::string(name)); it != context.outer_context.map_of_poptypes.end()) {
+	if(auto it = context.outer_context.map_of_poptypes.find(name); it != context.outer_context.map_of_poptypes.end()) {
 		trigger_building_context t_context{context.outer_context, trigger::slot_contents::pop, trigger::slot_contents::pop,
 				trigger::slot_contents::empty};
 		auto result = make_value_modifier(gen, err, t_context);
@@ -370,7 +370,7 @@ void read_promotion_target(std::string_view name, token_generator& gen, error_ha
 	}
 }
 void read_pop_ideology(std::string_view name, token_generator& gen, error_handler& err, poptype_context& context) {
-	if(auto it = context.outer_context.map_of_ideologies.find(std::string(name));
+	if(auto it = context.outer_context.map_of_ideologies.find(name);
 			it != context.outer_context.map_of_ideologies.end()) {
 		trigger_building_context t_context{context.outer_context, trigger::slot_contents::pop, trigger::slot_contents::pop,
 				trigger::slot_contents::empty};
@@ -381,7 +381,7 @@ void read_pop_ideology(std::string_view name, token_generator& gen, error_handle
 	}
 }
 void read_pop_issue(std::string_view name, token_generator& gen, error_handler& err, poptype_context& context) {
-	if(auto it = context.outer_context.map_of_ioptions.find(std::string(name)); it != context.outer_context.map_of_ioptions.end()) {
+	if(auto it = context.outer_context.map_of_ioptions.find(name); it != context.outer_context.map_of_ioptions.end()) {
 		trigger_building_context t_context{context.outer_context, trigger::slot_contents::pop, trigger::slot_contents::pop,
 				trigger::slot_contents::empty};
 		auto result = make_value_modifier(gen, err, t_context);
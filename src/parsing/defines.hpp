@@ -655,6 +655,7 @@
 	LUA_DEFINES_LIST_ELEMENT(alice_ai_threat_overestimate, 1.150000)                                                               \
 	LUA_DEFINES_LIST_ELEMENT(alice_ai_attack_target_radius, -0.996000)                                                             \
 	LUA_DEFINES_LIST_ELEMENT(alice_full_reinforce, 1.000000)                                                             \
+	LUA_DEFINES_LIST_ELEMENT(alice_unit_compaction_threshold, 0.000000)                                                            \
 
 
 namespace parsing {
@@ -191,7 +191,7 @@ void make_production_type(std::string_view name, token_generator& gen, error_han
 		context.outer_context.state.world.commodity_set_artisan_inputs(pt.output_goods_, cset);
 		context.outer_context.state.world.commodity_set_artisan_output_amount(pt.output_goods_, pt.value);
 	} else if(pt.type_ == production_type_enum::factory) {
-		if(auto it = context.outer_context.map_of_production_types.find(std::string(name));
+		if(auto it = context.outer_context.map_of_production_types.find(name);
 				it != context.outer_context.map_of_production_types.end()) {
 			auto factory_handle = fatten(context.outer_context.state.world, it->second);
 
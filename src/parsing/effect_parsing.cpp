@@ -1456,7 +1456,7 @@ void effect_body::any_value(std::string_view label, association_type t, std::str
 			return;
 		}
 	} else if(auto itf = context.outer_context.map_of_iissues.find(str_label); itf != context.outer_context.map_of_iissues.end()) {
-		if(auto itopt = context.outer_context.map_of_ioptions.find(std::string(value)); itopt != context.outer_context.map_of_ioptions.end()) {
+		if(auto itopt = context.outer_context.map_of_ioptions.find(value); itopt != context.outer_context.map_of_ioptions.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				auto cat = context.outer_context.state.world.issue_get_issue_type(itf->second);
 				if(cat == uint8_t(::culture::issue_category::political)) {
@@ -1478,7 +1478,7 @@ void effect_body::any_value(std::string_view label, association_type t, std::str
 			return;
 		}
 	} else if(auto ith = context.outer_context.map_of_reforms.find(str_label); ith != context.outer_context.map_of_reforms.end()) {
-		if(auto itopt = context.outer_context.map_of_roptions.find(std::string(value));
+		if(auto itopt = context.outer_context.map_of_roptions.find(value);
 				itopt != context.outer_context.map_of_roptions.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				auto cat = context.outer_context.state.world.reform_get_reform_type(ith->second);
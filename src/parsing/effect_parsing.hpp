@@ -59,7 +59,7 @@ struct ef_trigger_revolt {
 	dcon::ideology_id ideology_;
 	dcon::rebel_type_id type_;
 	void culture(association_type t, std::string_view value, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_culture_names.find(std::string(value));
+		if(auto it = context.outer_context.map_of_culture_names.find(value);
 				it != context.outer_context.map_of_culture_names.end()) {
 			culture_ = it->second;
 		} else {
@@ -68,7 +68,7 @@ struct ef_trigger_revolt {
 		}
 	}
 	void religion(association_type t, std::string_view value, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_religion_names.find(std::string(value));
+		if(auto it = context.outer_context.map_of_religion_names.find(value);
 				it != context.outer_context.map_of_religion_names.end()) {
 			religion_ = it->second;
 		} else {
@@ -77,7 +77,7 @@ struct ef_trigger_revolt {
 		}
 	}
 	void ideology(association_type t, std::string_view value, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_ideologies.find(std::string(value));
+		if(auto it = context.outer_context.map_of_ideologies.find(value);
 				it != context.outer_context.map_of_ideologies.end()) {
 			ideology_ = it->second.id;
 		} else {
@@ -86,7 +86,7 @@ struct ef_trigger_revolt {
 		}
 	}
 	void type(association_type t, std::string_view value, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_rebeltypes.find(std::string(value));
+		if(auto it = context.outer_context.map_of_rebeltypes.find(value);
 				it != context.outer_context.map_of_rebeltypes.end()) {
 			type_ = it->second.id;
 		} else {
@@ -111,7 +111,7 @@ struct ef_add_province_modifier {
 	dcon::modifier_id name_;
 	int32_t duration = 0;
 	void name(association_type t, std::string_view value, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+		if(auto it = context.outer_context.map_of_modifiers.find(value);
 				it != context.outer_context.map_of_modifiers.end()) {
 			name_ = it->second;
 		} else {
@@ -125,7 +125,7 @@ struct ef_add_country_modifier {
 	dcon::modifier_id name_;
 	int32_t duration = 0;
 	void name(association_type t, std::string_view value, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+		if(auto it = context.outer_context.map_of_modifiers.find(value);
 				it != context.outer_context.map_of_modifiers.end()) {
 			name_ = it->second;
 		} else {
@@ -140,7 +140,7 @@ struct ef_casus_belli {
 	std::string_view target;
 	int32_t months = 0;
 	void type(association_type t, std::string_view value, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_cb_types.find(std::string(value));
+		if(auto it = context.outer_context.map_of_cb_types.find(value);
 				it != context.outer_context.map_of_cb_types.end()) {
 			type_ = it->second.id;
 		} else {
@@ -155,7 +155,7 @@ struct ef_add_casus_belli {
 	std::string_view target;
 	int32_t months = 0;
 	void type(association_type t, std::string_view value, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_cb_types.find(std::string(value));
+		if(auto it = context.outer_context.map_of_cb_types.find(value);
 				it != context.outer_context.map_of_cb_types.end()) {
 			type_ = it->second.id;
 		} else {
@@ -169,7 +169,7 @@ struct ef_remove_casus_belli {
 	dcon::cb_type_id type_;
 	std::string_view target;
 	void type(association_type t, std::string_view value, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_cb_types.find(std::string(value));
+		if(auto it = context.outer_context.map_of_cb_types.find(value);
 				it != context.outer_context.map_of_cb_types.end()) {
 			type_ = it->second.id;
 		} else {
@@ -183,7 +183,7 @@ struct ef_this_remove_casus_belli {
 	dcon::cb_type_id type_;
 	std::string_view target;
 	void type(association_type t, std::string_view value, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_cb_types.find(std::string(value));
+		if(auto it = context.outer_context.map_of_cb_types.find(value);
 				it != context.outer_context.map_of_cb_types.end()) {
 			type_ = it->second.id;
 		} else {
@@ -219,7 +219,7 @@ struct ef_wargoal {
 	}
 	void casus_belli(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_cb_types.find(std::string(value));
+		if(auto it = context.outer_context.map_of_cb_types.find(value);
 				it != context.outer_context.map_of_cb_types.end()) {
 			casus_belli_ = it->second.id;
 		} else {
@@ -260,7 +260,7 @@ struct ef_sub_unit {
 	std::string_view value;
 	dcon::unit_type_id type_;
 	void type(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_unit_types.find(std::string(v));
+		if(auto it = context.outer_context.map_of_unit_types.find(v);
 				it != context.outer_context.map_of_unit_types.end()) {
 			type_ = it->second;
 		} else {
@@ -274,7 +274,7 @@ struct ef_set_variable {
 	float value = 0.0f;
 	dcon::national_variable_id which_;
 	void which(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		which_ = context.outer_context.get_national_variable(std::string(v));
+		which_ = context.outer_context.get_national_variable(v);
 	}
 	void finish(effect_building_context&) { }
 };
@@ -282,7 +282,7 @@ struct ef_change_variable {
 	float value = 0.0f;
 	dcon::national_variable_id which_;
 	void which(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		which_ = context.outer_context.get_national_variable(std::string(v));
+		which_ = context.outer_context.get_national_variable(v);
 	}
 	void finish(effect_building_context&) { }
 };
@@ -290,7 +290,7 @@ struct ef_ideology {
 	float factor = 0.0f;
 	dcon::ideology_id value_;
 	void value(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_ideologies.find(std::string(v));
+		if(auto it = context.outer_context.map_of_ideologies.find(v);
 				it != context.outer_context.map_of_ideologies.end()) {
 			value_ = it->second.id;
 		} else {
@@ -304,7 +304,7 @@ struct ef_dominant_issue {
 	float factor = 0.0f;
 	dcon::issue_option_id value_;
 	void value(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_ioptions.find(std::string(v)); it != context.outer_context.map_of_ioptions.end()) {
+		if(auto it = context.outer_context.map_of_ioptions.find(v); it != context.outer_context.map_of_ioptions.end()) {
 			value_ = it->second.id;
 		} else {
 			err.accumulated_errors +=
@@ -317,7 +317,7 @@ struct ef_upper_house {
 	float value = 0.0f;
 	dcon::ideology_id ideology_;
 	void ideology(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_ideologies.find(std::string(v));
+		if(auto it = context.outer_context.map_of_ideologies.find(v);
 				it != context.outer_context.map_of_ideologies.end()) {
 			ideology_ = it->second.id;
 		} else {
@@ -333,7 +333,7 @@ struct ef_scaled_militancy {
 	dcon::ideology_id ideology_;
 	dcon::issue_option_id issue_;
 	void ideology(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_ideologies.find(std::string(v));
+		if(auto it = context.outer_context.map_of_ideologies.find(v);
 				it != context.outer_context.map_of_ideologies.end()) {
 			ideology_ = it->second.id;
 		} else {
@@ -342,7 +342,7 @@ struct ef_scaled_militancy {
 		}
 	}
 	void issue(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_ioptions.find(std::string(v)); it != context.outer_context.map_of_ioptions.end()) {
+		if(auto it = context.outer_context.map_of_ioptions.find(v); it != context.outer_context.map_of_ioptions.end()) {
 			issue_ = it->second.id;
 		} else {
 			err.accumulated_errors +=
@@ -357,7 +357,7 @@ struct ef_scaled_consciousness {
 	dcon::ideology_id ideology_;
 	dcon::issue_option_id issue_;
 	void ideology(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_ideologies.find(std::string(v));
+		if(auto it = context.outer_context.map_of_ideologies.find(v);
 				it != context.outer_context.map_of_ideologies.end()) {
 			ideology_ = it->second.id;
 		} else {
@@ -366,7 +366,7 @@ struct ef_scaled_consciousness {
 		}
 	}
 	void issue(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_ioptions.find(std::string(v)); it != context.outer_context.map_of_ioptions.end()) {
+		if(auto it = context.outer_context.map_of_ioptions.find(v); it != context.outer_context.map_of_ioptions.end()) {
 			issue_ = it->second.id;
 		} else {
 			err.accumulated_errors +=
@@ -380,7 +380,7 @@ struct ef_define_general {
 	dcon::leader_trait_id background_;
 	dcon::leader_trait_id personality_;
 	void background(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_leader_traits.find(std::string(v));
+		if(auto it = context.outer_context.map_of_leader_traits.find(v);
 				it != context.outer_context.map_of_leader_traits.end()) {
 			background_ = it->second;
 		} else {
@@ -389,7 +389,7 @@ struct ef_define_general {
 		}
 	}
 	void personality(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_leader_traits.find(std::string(v));
+		if(auto it = context.outer_context.map_of_leader_traits.find(v);
 				it != context.outer_context.map_of_leader_traits.end()) {
 			personality_ = it->second;
 		} else {
@@ -404,7 +404,7 @@ struct ef_define_admiral {
 	dcon::leader_trait_id background_;
 	dcon::leader_trait_id personality_;
 	void background(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_leader_traits.find(std::string(v));
+		if(auto it = context.outer_context.map_of_leader_traits.find(v);
 				it != context.outer_context.map_of_leader_traits.end()) {
 			background_ = it->second;
 		} else {
@@ -413,7 +413,7 @@ struct ef_define_admiral {
 		}
 	}
 	void personality(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_leader_traits.find(std::string(v));
+		if(auto it = context.outer_context.map_of_leader_traits.find(v);
 				it != context.outer_context.map_of_leader_traits.end()) {
 			personality_ = it->second;
 		} else {
@@ -426,7 +426,7 @@ struct ef_define_admiral {
 struct ef_add_war_goal {
 	dcon::cb_type_id casus_belli_;
 	void casus_belli(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_cb_types.find(std::string(v)); it != context.outer_context.map_of_cb_types.end()) {
+		if(auto it = context.outer_context.map_of_cb_types.find(v); it != context.outer_context.map_of_cb_types.end()) {
 			casus_belli_ = it->second.id;
 		} else {
 			err.accumulated_errors +=
@@ -440,7 +440,7 @@ struct ef_move_issue_percentage {
 	dcon::issue_option_id from_;
 	dcon::issue_option_id to_;
 	void from(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_ioptions.find(std::string(v)); it != context.outer_context.map_of_ioptions.end()) {
+		if(auto it = context.outer_context.map_of_ioptions.find(v); it != context.outer_context.map_of_ioptions.end()) {
 			from_ = it->second.id;
 		} else {
 			err.accumulated_errors +=
@@ -448,7 +448,7 @@ struct ef_move_issue_percentage {
 		}
 	}
 	void to(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_ioptions.find(std::string(v)); it != context.outer_context.map_of_ioptions.end()) {
+		if(auto it = context.outer_context.map_of_ioptions.find(v); it != context.outer_context.map_of_ioptions.end()) {
 			to_ = it->second.id;
 		} else {
 			err.accumulated_errors +=
@@ -462,7 +462,7 @@ struct ef_party_loyalty {
 	dcon::province_id province_id_;
 	dcon::ideology_id ideology_;
 	void ideology(association_type t, std::string_view v, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_ideologies.find(std::string(v));
+		if(auto it = context.outer_context.map_of_ideologies.find(v);
 				it != context.outer_context.map_of_ideologies.end()) {
 			ideology_ = it->second.id;
 		} else {
@@ -835,7 +835,7 @@ struct effect_body {
 	}
 	void trade_goods(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_commodity_names.find(std::string(value));
+		if(auto it = context.outer_context.map_of_commodity_names.find(value);
 				it != context.outer_context.map_of_commodity_names.end()) {
 			if(context.main_slot == trigger::slot_contents::province) {
 				context.compiled_effect.push_back(uint16_t(effect::trade_goods));
@@ -856,7 +856,7 @@ struct effect_body {
 		if(context.main_slot == trigger::slot_contents::nation) {
 			if(is_fixed_token_ci(value.data(), value.data() + value.length(), "union")) {
 				context.compiled_effect.push_back(uint16_t(effect::add_accepted_culture_union | effect::no_payload));
-			} else if(auto it = context.outer_context.map_of_culture_names.find(std::string(value));
+			} else if(auto it = context.outer_context.map_of_culture_names.find(value);
 								it != context.outer_context.map_of_culture_names.end()) {
 				context.compiled_effect.push_back(uint16_t(effect::add_accepted_culture));
 				context.compiled_effect.push_back(trigger::payload(it->second).value);
@@ -897,7 +897,7 @@ struct effect_body {
 					return;
 				}
 			} else {
-				if(auto it = context.outer_context.map_of_culture_names.find(std::string(value));
+				if(auto it = context.outer_context.map_of_culture_names.find(value);
 						it != context.outer_context.map_of_culture_names.end()) {
 					context.compiled_effect.push_back(uint16_t(effect::primary_culture));
 					context.compiled_effect.push_back(trigger::payload(it->second).value);
@@ -915,7 +915,7 @@ struct effect_body {
 	void remove_accepted_culture(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
 		if(context.main_slot == trigger::slot_contents::nation) {
-			if(auto it = context.outer_context.map_of_culture_names.find(std::string(value));
+			if(auto it = context.outer_context.map_of_culture_names.find(value);
 					it != context.outer_context.map_of_culture_names.end()) {
 				context.compiled_effect.push_back(uint16_t(effect::remove_accepted_culture));
 				context.compiled_effect.push_back(trigger::payload(it->second).value);
@@ -945,7 +945,7 @@ struct effect_body {
 	}
 	void religion(association_type t, std::string_view value, error_handler& err, int32_t line, effect_building_context& context) {
 		if(context.main_slot == trigger::slot_contents::nation) {
-			if(auto it = context.outer_context.map_of_religion_names.find(std::string(value));
+			if(auto it = context.outer_context.map_of_religion_names.find(value);
 					it != context.outer_context.map_of_religion_names.end()) {
 				context.compiled_effect.push_back(uint16_t(effect::religion));
 				context.compiled_effect.push_back(trigger::payload(it->second).value);
@@ -995,7 +995,7 @@ struct effect_body {
 	void tech_school(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
 		if(context.main_slot == trigger::slot_contents::nation) {
-			if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+			if(auto it = context.outer_context.map_of_modifiers.find(value);
 					it != context.outer_context.map_of_modifiers.end()) {
 				context.compiled_effect.push_back(uint16_t(effect::tech_school));
 				context.compiled_effect.push_back(trigger::payload(it->second).value);
@@ -1021,7 +1021,7 @@ struct effect_body {
 																		std::to_string(line) + ")\n";
 					return;
 				}
-			} else if(auto it = context.outer_context.map_of_governments.find(std::string(value));
+			} else if(auto it = context.outer_context.map_of_governments.find(value);
 								it != context.outer_context.map_of_governments.end()) {
 				context.compiled_effect.push_back(uint16_t(effect::government));
 				context.compiled_effect.push_back(trigger::payload(it->second).value);
@@ -1127,13 +1127,13 @@ struct effect_body {
 			effect_building_context& context) {
 		if(context.main_slot == trigger::slot_contents::nation) {
 			context.compiled_effect.push_back(uint16_t(effect::set_country_flag));
-			context.compiled_effect.push_back(trigger::payload(context.outer_context.get_national_flag(std::string(value))).value);
+			context.compiled_effect.push_back(trigger::payload(context.outer_context.get_national_flag(value)).value);
 		} else if(context.main_slot == trigger::slot_contents::province) {
 			context.compiled_effect.push_back(uint16_t(effect::set_country_flag_province));
-			context.compiled_effect.push_back(trigger::payload(context.outer_context.get_national_flag(std::string(value))).value);
+			context.compiled_effect.push_back(trigger::payload(context.outer_context.get_national_flag(value)).value);
 		} else if(context.main_slot == trigger::slot_contents::pop) {
 			context.compiled_effect.push_back(uint16_t(effect::set_country_flag_pop));
-			context.compiled_effect.push_back(trigger::payload(context.outer_context.get_national_flag(std::string(value))).value);
+			context.compiled_effect.push_back(trigger::payload(context.outer_context.get_national_flag(value)).value);
 		} else {
 			err.accumulated_errors +=
 					"set_country_flag effect used in an incorrect scope type (" + err.file_name + ", line " + std::to_string(line) + ")\n";
@@ -1144,7 +1144,7 @@ struct effect_body {
 			effect_building_context& context) {
 		if(context.main_slot == trigger::slot_contents::nation) {
 			context.compiled_effect.push_back(uint16_t(effect::clr_country_flag));
-			context.compiled_effect.push_back(trigger::payload(context.outer_context.get_national_flag(std::string(value))).value);
+			context.compiled_effect.push_back(trigger::payload(context.outer_context.get_national_flag(value)).value);
 		} else {
 			err.accumulated_errors +=
 					"clr_country_flag effect used in an incorrect scope type (" + err.file_name + ", line " + std::to_string(line) + ")\n";
@@ -1858,7 +1858,7 @@ struct effect_body {
 	}
 	void enable_ideology(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_ideologies.find(std::string(value));
+		if(auto it = context.outer_context.map_of_ideologies.find(value);
 				it != context.outer_context.map_of_ideologies.end()) {
 			context.compiled_effect.push_back(uint16_t(effect::enable_ideology));
 			context.compiled_effect.push_back(trigger::payload(it->second.id).value);
@@ -1871,7 +1871,7 @@ struct effect_body {
 	void ruling_party_ideology(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
 		if(context.main_slot == trigger::slot_contents::nation) {
-			if(auto it = context.outer_context.map_of_ideologies.find(std::string(value));
+			if(auto it = context.outer_context.map_of_ideologies.find(value);
 					it != context.outer_context.map_of_ideologies.end()) {
 				context.compiled_effect.push_back(uint16_t(effect::ruling_party_ideology));
 				context.compiled_effect.push_back(trigger::payload(it->second.id).value);
@@ -1899,7 +1899,7 @@ struct effect_body {
 	void remove_province_modifier(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
 		if(context.main_slot == trigger::slot_contents::province) {
-			if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+			if(auto it = context.outer_context.map_of_modifiers.find(value);
 					it != context.outer_context.map_of_modifiers.end()) {
 				context.compiled_effect.push_back(uint16_t(effect::remove_province_modifier));
 				context.compiled_effect.push_back(trigger::payload(it->second).value);
@@ -1909,7 +1909,7 @@ struct effect_body {
 				return;
 			}
 		} else if(context.main_slot == trigger::slot_contents::state) {
-			if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+			if(auto it = context.outer_context.map_of_modifiers.find(value);
 					it != context.outer_context.map_of_modifiers.end()) {
 				context.compiled_effect.push_back(uint16_t(effect::remove_province_modifier_state));
 				context.compiled_effect.push_back(trigger::payload(it->second).value);
@@ -1927,7 +1927,7 @@ struct effect_body {
 	void remove_country_modifier(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
 		if(context.main_slot == trigger::slot_contents::nation) {
-			if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+			if(auto it = context.outer_context.map_of_modifiers.find(value);
 					it != context.outer_context.map_of_modifiers.end()) {
 				context.compiled_effect.push_back(uint16_t(effect::remove_country_modifier));
 				context.compiled_effect.push_back(trigger::payload(it->second).value);
@@ -2097,16 +2097,16 @@ struct effect_body {
 	void set_global_flag(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
 		context.compiled_effect.push_back(uint16_t(effect::set_global_flag));
-		context.compiled_effect.push_back(trigger::payload(context.outer_context.get_global_flag(std::string(value))).value);
+		context.compiled_effect.push_back(trigger::payload(context.outer_context.get_global_flag(value)).value);
 	}
 	void clr_global_flag(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
 		context.compiled_effect.push_back(uint16_t(effect::clr_global_flag));
-		context.compiled_effect.push_back(trigger::payload(context.outer_context.get_global_flag(std::string(value))).value);
+		context.compiled_effect.push_back(trigger::payload(context.outer_context.get_global_flag(value)).value);
 	}
 	void nationalvalue(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+		if(auto it = context.outer_context.map_of_modifiers.find(value);
 				it != context.outer_context.map_of_modifiers.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_effect.push_back(uint16_t(effect::nationalvalue_nation));
@@ -2148,7 +2148,7 @@ struct effect_body {
 	}
 	void social_reform(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_ioptions.find(std::string(value));
+		if(auto it = context.outer_context.map_of_ioptions.find(value);
 				it != context.outer_context.map_of_ioptions.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_effect.push_back(uint16_t(effect::social_reform));
@@ -2169,7 +2169,7 @@ struct effect_body {
 	}
 	void political_reform(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_ioptions.find(std::string(value));
+		if(auto it = context.outer_context.map_of_ioptions.find(value);
 				it != context.outer_context.map_of_ioptions.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_effect.push_back(uint16_t(effect::political_reform));
@@ -2245,7 +2245,7 @@ struct effect_body {
 		}
 	}
 	void pop_type(association_type t, std::string_view value, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_poptypes.find(std::string(value));
+		if(auto it = context.outer_context.map_of_poptypes.find(value);
 				it != context.outer_context.map_of_poptypes.end()) {
 			if(context.main_slot == trigger::slot_contents::pop) {
 				context.compiled_effect.push_back(uint16_t(effect::pop_type));
@@ -2286,7 +2286,7 @@ struct effect_body {
 	}
 	void military_reform(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_roptions.find(std::string(value));
+		if(auto it = context.outer_context.map_of_roptions.find(value);
 				it != context.outer_context.map_of_roptions.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_effect.push_back(uint16_t(effect::military_reform));
@@ -2304,7 +2304,7 @@ struct effect_body {
 	}
 	void economic_reform(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_roptions.find(std::string(value));
+		if(auto it = context.outer_context.map_of_roptions.find(value);
 				it != context.outer_context.map_of_roptions.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_effect.push_back(uint16_t(effect::economic_reform));
@@ -2343,7 +2343,7 @@ struct effect_body {
 		}
 	}
 	void add_crime(association_type t, std::string_view value, error_handler& err, int32_t line, effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_crimes.find(std::string(value)); it != context.outer_context.map_of_crimes.end()) {
+		if(auto it = context.outer_context.map_of_crimes.find(value); it != context.outer_context.map_of_crimes.end()) {
 			if(context.main_slot == trigger::slot_contents::province) {
 				context.compiled_effect.push_back(uint16_t(effect::add_crime));
 				context.compiled_effect.push_back(trigger::payload(it->second.id).value);
@@ -2372,7 +2372,7 @@ struct effect_body {
 	}
 	void build_factory_in_capital_state(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_factory_names.find(std::string(value));
+		if(auto it = context.outer_context.map_of_factory_names.find(value);
 				it != context.outer_context.map_of_factory_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_effect.push_back(uint16_t(effect::build_factory_in_capital_state));
@@ -2390,7 +2390,7 @@ struct effect_body {
 	}
 	void activate_technology(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
-		if(auto it = context.outer_context.map_of_technologies.find(std::string(value));
+		if(auto it = context.outer_context.map_of_technologies.find(value);
 				it != context.outer_context.map_of_technologies.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_effect.push_back(uint16_t(effect::activate_technology));
@@ -2400,7 +2400,7 @@ struct effect_body {
 																	std::to_string(line) + ")\n";
 				return;
 			}
-		} else if(auto itb = context.outer_context.map_of_inventions.find(std::string(value));
+		} else if(auto itb = context.outer_context.map_of_inventions.find(value);
 							itb != context.outer_context.map_of_inventions.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_effect.push_back(uint16_t(effect::activate_invention));
@@ -2531,7 +2531,7 @@ struct effect_body {
 	void add_province_modifier(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
 		if(context.main_slot == trigger::slot_contents::province) {
-			if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+			if(auto it = context.outer_context.map_of_modifiers.find(value);
 					it != context.outer_context.map_of_modifiers.end()) {
 				context.compiled_effect.push_back(uint16_t(effect::add_province_modifier_no_duration));
 				context.compiled_effect.push_back(trigger::payload(it->second).value);
@@ -2541,7 +2541,7 @@ struct effect_body {
 				return;
 			}
 		} else if(context.main_slot == trigger::slot_contents::state) {
-			if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+			if(auto it = context.outer_context.map_of_modifiers.find(value);
 					it != context.outer_context.map_of_modifiers.end()) {
 				context.compiled_effect.push_back(uint16_t(effect::add_province_modifier_state_no_duration));
 				context.compiled_effect.push_back(trigger::payload(it->second).value);
@@ -2559,7 +2559,7 @@ struct effect_body {
 	void add_country_modifier(association_type t, std::string_view value, error_handler& err, int32_t line,
 			effect_building_context& context) {
 		if(context.main_slot == trigger::slot_contents::nation) {
-			if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+			if(auto it = context.outer_context.map_of_modifiers.find(value);
 					it != context.outer_context.map_of_modifiers.end()) {
 				context.compiled_effect.push_back(uint16_t(effect::add_country_modifier_no_duration));
 				context.compiled_effect.push_back(trigger::payload(it->second).value);
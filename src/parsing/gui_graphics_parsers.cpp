@@ -32,7 +32,7 @@ obj_and_horizontal common_create_object(gfx_object const& obj_in, building_gfx_c
 
 	if(obj_in.primary_texture.length() > 0) {
 		auto stripped = simple_fs::remove_double_backslashes(obj_in.primary_texture);
-		if(auto it = context.map_of_texture_names.find(std::string(stripped)); it != context.map_of_texture_names.end()) {
+		if(auto it = context.map_of_texture_names.find(stripped); it != context.map_of_texture_names.end()) {
 			new_obj.primary_texture_handle = it->second;
 		} else {
 			auto index = context.ui_defs.textures.size();
@@ -187,7 +187,7 @@ button::button() {
 void button::spritetype(association_type, std::string_view txt, error_handler& err, int32_t line, building_gfx_context& context) {
 	if(txt.length() == 0)
 		return;
-	auto it = context.map_of_names.find(std::string(txt));
+	auto it = context.map_of_names.find(txt);
 	if(it != context.map_of_names.end()) {
 		target.data.button.button_image = it->second;
 	} else {
@@ -457,7 +457,7 @@ void image::frame(association_type, uint32_t v, error_handler& err, int32_t line
 void image::spritetype(association_type, std::string_view txt, error_handler& err, int32_t line, building_gfx_context& context) {
 	if(txt.length() == 0)
 		return;
-	auto it = context.map_of_names.find(std::string(txt));
+	auto it = context.map_of_names.find(txt);
 	if(it != context.map_of_names.end()) {
 		target.data.image.gfx_object = it->second;
 	} else {
@@ -539,7 +539,7 @@ void listbox::background(association_type, std::string_view txt, error_handler&
 		building_gfx_context& context) {
 	if(txt.length() == 0)
 		return;
-	auto it = context.map_of_names.find(std::string(txt));
+	auto it = context.map_of_names.find(txt);
 	if(it != context.map_of_names.end()) {
 		target.data.list_box.background_image = it->second;
 	} else {
@@ -4,7 +4,7 @@
 namespace parsers {
 
 void register_cb_type(std::string_view name, token_generator& gen, error_handler& err, scenario_building_context& context) {
-	auto existing_it = context.map_of_cb_types.find(std::string(name));
+	auto existing_it = context.map_of_cb_types.find(name);
 
 	auto id = [&]() {
 		if(existing_it != context.map_of_cb_types.end()) {
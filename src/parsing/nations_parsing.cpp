@@ -718,7 +718,7 @@ void make_party(token_generator& gen, error_handler& err, country_file_context&
 }
 
 void make_unit_names_list(std::string_view name, token_generator& gen, error_handler& err, country_file_context& context) {
-	if(auto it = context.outer_context.map_of_unit_types.find(std::string(name));
+	if(auto it = context.outer_context.map_of_unit_types.find(name);
 			it != context.outer_context.map_of_unit_types.end()) {
 		auto found_type = it->second;
 		unit_names_context new_context{context.outer_context, context.id, found_type};
@@ -729,45 +729,55 @@ void make_unit_names_list(std::string_view name, token_generator& gen, error_han
 	}
 }
 
-dcon::national_variable_id scenario_building_context::get_national_variable(std::string const& name) {
+dcon::national_variable_id scenario_building_context::get_national_variable(std::string_view name) {
 	if(auto it = map_of_national_variables.find(name); it != map_of_national_variables.end()) {
 		return it->second;
 	} else {
 		dcon::national_variable_id new_id = dcon::national_variable_id(
 				dcon::national_variable_id::value_base_t(state.national_definitions.num_allocated_national_variables));
 		++state.national_definitions.num_allocated_national_variables;
-		map_of_national_variables.insert_or_assign(name, new_id);
+		map_of_national_variables.insert_or_assign(std::string(name), new_id);
 		state.national_definitions.variable_names.safe_get(new_id) = text::find_or_add_key(state, name);
 		return new_id;
 	}
 }
 
-dcon::national_flag_id scenario_building_context::get_national_flag(std::string const& name) {
+dcon::national_flag_id scenario_building_context::get_national_flag(std::string_view name) {
 	if(auto it = map_of_national_flags.find(name); it != map_of_national_flags.end()) {
 		return it->second;
 	} else {
 		dcon::national_flag_id new_id =
 				dcon::national_flag_id(dcon::national_flag_id::value_base_t(state.national_definitions.num_allocated_national_flags));
 		++state.national_definitions.num_allocated_national_flags;
-		map_of_national_flags.insert_or_assign(name, new_id);
+		map_of_national_flags.insert_or_assign(std::string(name), new_id);
 		state.national_definitions.flag_variable_names.safe_get(new_id) = text::find_or_add_key(state, name);
 		return new_id;
 	}
 }
 
-dcon::global_flag_id scenario_building_context::get_global_flag(std::string const& name) {
+dcon::global_flag_id scenario_building_context::get_global_flag(std::string_view name) {
 	if(auto it = map_of_global_flags.find(name); it != map_of_global_flags.end()) {
 		return it->second;
 	} else {
 		dcon::global_flag_id new_id =
 				dcon::global_flag_id(dcon::global_flag_id::value_base_t(state.national_definitions.num_allocated_global_flags));
 		++state.national_definitions.num_allocated_global_flags;
-		map_of_global_flags.insert_or_assign(name, new_id);
+		map_of_global_flags.insert_or_assign(std::string(name), new_id);
 		state.national_definitions.global_flag_variable_names.safe_get(new_id) = text::find_or_add_key(state, name);
 		return new_id;
 	}
 }
 
+uint32_t scenario_building_context::get_event_file_name(std::string const& name) {
+	// events are scanned one file at a time, so the name is almost always the one added last
+	for(auto i = event_file_names.size(); i-- > 0;) {
+		if(event_file_names[i] == name)
+			return uint32_t(i);
+	}
+	event_file_names.push_back(name);
+	return uint32_t(event_file_names.size() - 1);
+}
+
 dcon::trigger_key read_triggered_modifier_condition(token_generator& gen, error_handler& err, scenario_building_context& context) {
 	trigger_building_context t_context{context, trigger::slot_contents::nation, trigger::slot_contents::nation,
 			trigger::slot_contents::empty};
@@ -901,11 +911,11 @@ void scan_province_event(token_generator& gen, error_handler& err, scenario_buil
 			} else {
 				it->second.generator_state = gen;
 				it->second.text_assigned = true;
-				it->second.original_file = err.file_name;
+				it->second.original_file = context.get_event_file_name(err.file_name);
 			}
 		} else {
 			context.map_of_provincial_events.insert_or_assign(scan_result.id,
-					pending_prov_event{ err.file_name, dcon::provincial_event_id(), trigger::slot_contents::empty, trigger::slot_contents::empty,
+					pending_prov_event{ context.get_event_file_name(err.file_name), dcon::provincial_event_id(), trigger::slot_contents::empty, trigger::slot_contents::empty,
 							trigger::slot_contents::empty, gen, false});
 		}
 		gen = scan_copy;
@@ -916,11 +926,11 @@ void scan_province_event(token_generator& gen, error_handler& err, scenario_buil
 			} else {
 				it->second.generator_state = gen;
 				it->second.text_assigned = true;
-				it->second.original_file = err.file_name;
+				it->second.original_file = context.get_event_file_name(err.file_name);
 			}
 		} else {
 			context.map_of_provincial_events.insert_or_assign(scan_result.id,
-					pending_prov_event{ err.file_name, dcon::provincial_event_id(), trigger::slot_contents::empty, trigger::slot_contents::empty,
+					pending_prov_event{ context.get_event_file_name(err.file_name), dcon::provincial_event_id(), trigger::slot_contents::empty, trigger::slot_contents::empty,
 							trigger::slot_contents::empty, gen, true });
 		}
 
@@ -948,11 +958,11 @@ void scan_country_event(token_generator& gen, error_handler& err, scenario_build
 			} else {
 				it->second.generator_state = gen;
 				it->second.text_assigned = true;
-				it->second.original_file = err.file_name;
+				it->second.original_file = context.get_event_file_name(err.file_name);
 			}
 		} else {
 			context.map_of_national_events.insert_or_assign(scan_result.id,
-					pending_nat_event{ err.file_name, dcon::national_event_id(), trigger::slot_contents::empty, trigger::slot_contents::empty,
+					pending_nat_event{ context.get_event_file_name(err.file_name), dcon::national_event_id(), trigger::slot_contents::empty, trigger::slot_contents::empty,
 							trigger::slot_contents::empty, gen, false});
 		}
 		gen = scan_copy;
@@ -963,11 +973,11 @@ void scan_country_event(token_generator& gen, error_handler& err, scenario_build
 			} else {
 				it->second.generator_state = gen;
 				it->second.text_assigned = true;
-				it->second.original_file = err.file_name;
+				it->second.original_file = context.get_event_file_name(err.file_name);
 			}
 		} else {
 			context.map_of_national_events.insert_or_assign(scan_result.id,
-					pending_nat_event{ err.file_name, dcon::national_event_id(), trigger::slot_contents::empty, trigger::slot_contents::empty,
+					pending_nat_event{ context.get_event_file_name(err.file_name), dcon::national_event_id(), trigger::slot_contents::empty, trigger::slot_contents::empty,
 							trigger::slot_contents::empty, gen, true });
 		}
 
@@ -1051,7 +1061,7 @@ void commit_pending_events(error_handler& err, scenario_building_context& contex
 
 				auto data_copy = e.second;
 
-				err.file_name = e.second.original_file + " [pending]";
+				err.file_name = context.event_file_names[e.second.original_file] + " [pending]";
 
 				event_building_context e_context{context, data_copy.main_slot, data_copy.this_slot, data_copy.from_slot};
 				auto event_result = parse_generic_event(data_copy.generator_state, err, e_context);
@@ -1156,7 +1166,7 @@ void commit_pending_events(error_handler& err, scenario_building_context& contex
 
 				auto data_copy = e.second;
 
-				err.file_name = e.second.original_file + " [pending]";
+				err.file_name = context.event_file_names[e.second.original_file] + " [pending]";
 
 				event_building_context e_context{context, data_copy.main_slot, data_copy.this_slot, data_copy.from_slot};
 				auto event_result = parse_generic_event(data_copy.generator_state, err, e_context);
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stdint.h>
+#include <cstring>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+
+// Shared between the parser generator, which builds perfect hash tables for large groups of keys, and the generated parsers,
+// which look keys up in them. Keep this header free of other project includes: the parser generator is built on its own.
+
+namespace parsers {
+
+inline uint32_t case_folded_key_hash(std::string_view key) {
+	// looks at no more than the first, middle and last eight characters, so hashing costs the same for keys of any length
+	uint64_t const fold = 0x2020202020202020;
+	uint64_t const n = key.length();
+	uint64_t hash = n * 0x9E3779B97F4A7C15;
+	if(n >= 8) {
+		uint64_t first = 0;
+		uint64_t middle = 0;
+		uint64_t last = 0;
+		memcpy(&first, key.data(), 8);
+		memcpy(&middle, key.data() + n / 2 - 4, 8);
+		memcpy(&last, key.data() + n - 8, 8);
+		hash ^= (first | fold) * 0xC2B2AE3D27D4EB4F;
+		hash ^= (middle | fold) * 0x165667B19E3779F9;
+		hash ^= (last | fold) * 0xD6E8FEB86659FD93;
+	} else {
+		uint64_t packed = 0;
+		for(auto c : key)
+			packed = (packed << 8) | uint8_t(c | 0x20);
+		hash ^= packed * 0xC2B2AE3D27D4EB4F;
+	}
+	return uint32_t(hash ^ (hash >> 29) ^ (hash >> 47));
+}
+inline uint32_t perfect_hash_slot(uint32_t hash, uint32_t displacement, uint32_t table_size) {
+	uint32_t mixed = (hash ^ displacement) * 0x9E3779B1;
+	return (mixed ^ (mixed >> 16)) % table_size;
+}
+
+inline constexpr uint32_t keys_per_displacement_bucket = 4;
+inline constexpr uint32_t max_displacement = 1 << 20;
+
+inline uint32_t perfect_hash_bucket_count(uint32_t table_size) {
+	return std::max(uint32_t(1), table_size / keys_per_displacement_bucket);
+}
+
+// Finds a displacement for every bucket of keys (bucket = hash % bucket count) such that every key lands in its own slot of a
+// table with exactly one slot per key (hash and displace). Returns an empty vector if no such assignment is found, which is
+// always the case when two keys share a hash.
+inline std::vector<uint32_t> find_perfect_hash_displacements(std::vector<uint32_t> const& key_hashes) {
+	uint32_t const table_size = uint32_t(key_hashes.size());
+	uint32_t const bucket_count = perfect_hash_bucket_count(table_size);
+
+	std::vector<std::vector<uint32_t>> buckets(bucket_count);
+	for(auto hash : key_hashes)
+		buckets[hash % bucket_count].push_back(hash);
+	std::vector<uint32_t> bucket_order(bucket_count);
+	for(uint32_t i = 0; i < bucket_count; ++i)
+		bucket_order[i] = i;
+	std::stable_sort(bucket_order.begin(), bucket_order.end(), [&](uint32_t a, uint32_t b) { return buckets[a].size() > buckets[b].size(); });
+
+	std::vector<uint32_t> displacements(bucket_count, 0);
+	std::vector<bool> slot_taken(table_size, false);
+	std::vector<uint32_t> bucket_slots;
+	for(auto b : bucket_order) {
+		if(buckets[b].empty())
+			break;
+		bool placed = false;
+		for(uint32_t d = 0; d < max_displacement && !placed; ++d) {
+			bucket_slots.clear();
+			placed = true;
+			for(auto hash : buckets[b]) {
+				auto const slot = perfect_hash_slot(hash, d, table_size);
+				if(slot_taken[slot] || std::find(bucket_slots.begin(), bucket_slots.end(), slot) != bucket_slots.end()) {
+					placed = false;
+					break;
+				}
+				bucket_slots.push_back(slot);
+			}
+			if(placed) {
+				displacements[b] = d;
+				for(auto slot : bucket_slots)
+					slot_taken[slot] = true;
+			}
+		}
+		if(!placed)
+			return std::vector<uint32_t>{};
+	}
+	return displacements;
+}
+
+} // namespace parsers
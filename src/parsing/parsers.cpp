@@ -2,6 +2,11 @@
 #include "nations.hpp"
 #include <charconv>
 #include <algorithm>
+#include <bit>
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#define PARSERS_SIMD_SCAN 1
+#endif
 
 namespace parsers {
 bool ignorable_char(char c) {
@@ -95,13 +100,100 @@ char const* scan_for_not_match(char const* start, char const* end, int32_t& curr
 	return start;
 }
 
+/*
+* Vectorized versions of scan_for_match / scan_for_not_match for a fixed set of characters. A whole block of the file
+* is compared against every character of the set at once, giving a bit mask with one bit per byte; the first set bit
+* is the position we are looking for, and the newlines before it are counted with a popcount. The first few characters
+* and whatever is left at the end of the file, less than one block, go through the scalar scan.
+*/
+
+#ifdef PARSERS_SIMD_SCAN
+#ifdef __AVX2__
+constexpr int32_t scan_block_width = 32;
+using scan_block = __m256i;
+inline scan_block load_scan_block(char const* p) {
+	return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p));
+}
+inline uint32_t scan_block_mask(scan_block b, char c) {
+	return uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(b, _mm256_set1_epi8(c))));
+}
+constexpr uint32_t scan_block_all = 0xFFFFFFFF;
+#else
+constexpr int32_t scan_block_width = 16;
+using scan_block = __m128i;
+inline scan_block load_scan_block(char const* p) {
+	return _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+}
+inline uint32_t scan_block_mask(scan_block b, char c) {
+	return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(b, _mm_set1_epi8(c))));
+}
+constexpr uint32_t scan_block_all = 0xFFFF;
+#endif
+constexpr int32_t scan_short_run = 8;
+#endif
+
+template<char... C>
+char const* scan_for_any_of(char const* start, char const* end, int32_t& current_line) {
+	auto is_member = [](char c) { return ((c == C) || ...); };
+#ifdef PARSERS_SIMD_SCAN
+	// most runs are only a few characters long, and those are found faster without setting up a block
+	for(auto const short_end = std::min(end, start + scan_short_run); start < short_end; ++start) {
+		if(is_member(*start))
+			return start;
+		if(*start == '\n')
+			++current_line;
+	}
+	while(end - start >= scan_block_width) {
+		auto const b = load_scan_block(start);
+		uint32_t const found = (scan_block_mask(b, C) | ...);
+		uint32_t const newlines = scan_block_mask(b, '\n');
+		if(found != 0) {
+			auto const index = std::countr_zero(found);
+			current_line += std::popcount(newlines & ((uint32_t(1) << index) - 1));
+			return start + index;
+		}
+		current_line += std::popcount(newlines);
+		start += scan_block_width;
+	}
+#endif
+	return scan_for_match(start, end, current_line, is_member);
+}
+
+template<char... C>
+char const* scan_for_none_of(char const* start, char const* end, int32_t& current_line) {
+	auto is_member = [](char c) { return ((c == C) || ...); };
+#ifdef PARSERS_SIMD_SCAN
+	// most runs are only a few characters long, and those are found faster without setting up a block
+	for(auto const short_end = std::min(end, start + scan_short_run); start < short_end; ++start) {
+		if(!is_member(*start))
+			return start;
+		if(*start == '\n')
+			++current_line;
+	}
+	while(end - start >= scan_block_width) {
+		auto const b = load_scan_block(start);
+		uint32_t const found = ~(scan_block_mask(b, C) | ...) & scan_block_all;
+		uint32_t const newlines = scan_block_mask(b, '\n');
+		if(found != 0) {
+			auto const index = std::countr_zero(found);
+			current_line += std::popcount(newlines & ((uint32_t(1) << index) - 1));
+			return start + index;
+		}
+		current_line += std::popcount(newlines);
+		start += scan_block_width;
+	}
+#endif
+	return scan_for_not_match(start, end, current_line, is_member);
+}
+
+// the character sets below must be kept in sync with ignorable_char, breaking_char, etc. above
 char const* advance_position_to_next_line(char const* start, char const* end, int32_t& current_line) {
-	auto const start_lterm = scan_for_match(start, end, current_line, line_termination);
-	return scan_for_not_match(start_lterm, end, current_line, line_termination);
+	auto const start_lterm = scan_for_any_of<'\r', '\n'>(start, end, current_line);
+	return scan_for_none_of<'\r', '\n'>(start_lterm, end, current_line);
 }
 
 char const* advance_position_to_non_whitespace(char const* start, char const* end, int32_t& current_line) {
-	return scan_for_not_match(start, end, current_line, ignorable_char);
+	return scan_for_none_of<' ', '\r', '\f', '\n', '\t', ',', ';'>(start, end, current_line);
 }
 
 char const* advance_position_to_non_comment(char const* start, char const* end, int32_t& current_line) {
@@ -114,7 +206,7 @@ char const* advance_position_to_non_comment(char const* start, char const* end,
 }
 
 char const* advance_position_to_breaking_char(char const* start, char const* end, int32_t& current_line) {
-	return scan_for_match(start, end, current_line, breaking_char);
+	return scan_for_any_of<' ', '\r', '\f', '\n', '\t', ',', ';', '{', '}', '!', '=', '<', '>', '#'>(start, end, current_line);
 }
 
 token_and_type token_generator::internal_next() {
@@ -130,11 +222,11 @@ token_and_type token_generator::internal_next() {
 			position = non_ws + 1;
 			return token_and_type{std::string_view(non_ws, 1), current_line, token_type::close_brace};
 		} else if(*non_ws == '\"') {
-			auto const close = scan_for_match(non_ws + 1, file_end, current_line, double_quote_termination);
+			auto const close = scan_for_any_of<'\r', '\n', '\"'>(non_ws + 1, file_end, current_line);
 			position = close + 1;
 			return token_and_type{std::string_view(non_ws + 1, close - (non_ws + 1)), current_line, token_type::quoted_string};
 		} else if(*non_ws == '\'') {
-			auto const close = scan_for_match(non_ws + 1, file_end, current_line, single_quote_termination);
+			auto const close = scan_for_any_of<'\r', '\n', '\''>(non_ws + 1, file_end, current_line);
 			position = close + 1;
 			return token_and_type{std::string_view(non_ws + 1, close - (non_ws + 1)), current_line, token_type::quoted_string};
 		} else if(has_fixed_prefix(non_ws, file_end, "==") || has_fixed_prefix(non_ws, file_end, "<=") ||
@@ -3,7 +3,9 @@
 #include <string_view>
 #include <stdint.h>
 #include <string>
+#include <cstring>
 #include "date_interface.hpp"
+#include "parser_key_hash.hpp"
 
 /*
  * must support
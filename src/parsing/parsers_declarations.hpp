@@ -4,6 +4,7 @@
 #include <optional>
 #include <string_view>
 #include <string>
+#include <functional>
 
 #include "constants.hpp"
 #include "parsers.hpp"
@@ -24,11 +25,24 @@ namespace parsers {
 //
 std::string lowercase_str(std::string_view sv);
 
+// Hashes std::string and std::string_view alike, so that the name maps below can be searched directly with the
+// string_views produced by the parser instead of with a temporary std::string
+struct string_hash {
+	using is_avalanching = void;
+	using is_transparent = void;
+
+	auto operator()(std::string_view sv) const noexcept -> uint64_t {
+		return ankerl::unordered_dense::detail::wyhash::hash(sv.data(), sv.size());
+	}
+};
+template<typename T>
+using string_map = ankerl::unordered_dense::map<std::string, T, string_hash, std::equal_to<>>;
+
 struct building_gfx_context {
 	sys::state& full_state;
 	ui::definitions& ui_defs;
-	ankerl::unordered_dense::map<std::string, dcon::gfx_object_id> map_of_names;
-	ankerl::unordered_dense::map<std::string, dcon::texture_id> map_of_texture_names;
+	string_map<dcon::gfx_object_id> map_of_names;
+	string_map<dcon::texture_id> map_of_texture_names;
 	bool on_second_pair_y = false;
 	building_gfx_context(sys::state& full_state, ui::definitions& ui_defs) : full_state(full_state), ui_defs(ui_defs) { }
 };
@@ -270,7 +284,7 @@ struct pending_invention_content {
 	dcon::invention_id id;
 };
 struct pending_nat_event {
-	std::string original_file;
+	uint32_t original_file = 0; // index into scenario_building_context::event_file_names
 	dcon::national_event_id id;
 	trigger::slot_contents main_slot;
 	trigger::slot_contents this_slot;
@@ -288,13 +302,13 @@ struct pending_nat_event {
 			trigger::slot_contents from_slot, token_generator const& generator_state)
 			: id(id), main_slot(main_slot), this_slot(this_slot), from_slot(from_slot), generator_state(generator_state),
 				text_assigned(true), just_in_case_placeholder(false){ }
-	pending_nat_event(std::string const& original_file, dcon::national_event_id id, trigger::slot_contents main_slot, trigger::slot_contents this_slot,
+	pending_nat_event(uint32_t original_file, dcon::national_event_id id, trigger::slot_contents main_slot, trigger::slot_contents this_slot,
 			trigger::slot_contents from_slot, token_generator const& generator_state, bool just_in_case_placeholder)
 		: original_file(original_file), id(id), main_slot(main_slot), this_slot(this_slot), from_slot(from_slot), generator_state(generator_state),
 		text_assigned(true), just_in_case_placeholder(just_in_case_placeholder) { }
 };
 struct pending_prov_event {
-	std::string original_file;
+	uint32_t original_file = 0; // index into scenario_building_context::event_file_names
 	dcon::provincial_event_id id;
 	trigger::slot_contents main_slot;
 	trigger::slot_contents this_slot;
@@ -312,7 +326,7 @@ struct pending_prov_event {
 			trigger::slot_contents from_slot, token_generator const& generator_state)
 			: id(id), main_slot(main_slot), this_slot(this_slot), from_slot(from_slot), generator_state(generator_state),
 				text_assigned(true), just_in_case_placeholder(false) { }
-	pending_prov_event(std::string const& original_file, dcon::provincial_event_id id, trigger::slot_contents main_slot, trigger::slot_contents this_slot,
+	pending_prov_event(uint32_t original_file, dcon::provincial_event_id id, trigger::slot_contents main_slot, trigger::slot_contents this_slot,
 			trigger::slot_contents from_slot, token_generator const& generator_state, bool just_in_case_placeholder)
 		: original_file(original_file), id(id), main_slot(main_slot), this_slot(this_slot), from_slot(from_slot), generator_state(generator_state),
 		text_assigned(true), just_in_case_placeholder(just_in_case_placeholder) { }
@@ -325,39 +339,40 @@ struct scenario_building_context {
 	ankerl::unordered_dense::map<uint32_t, dcon::national_identity_id> map_of_ident_names;
 	tagged_vector<std::string, dcon::national_identity_id> file_names_for_idents;
 
-	ankerl::unordered_dense::map<std::string, dcon::religion_id> map_of_religion_names;
-	ankerl::unordered_dense::map<std::string, dcon::culture_id> map_of_culture_names;
-	ankerl::unordered_dense::map<std::string, dcon::culture_group_id> map_of_culture_group_names;
-	ankerl::unordered_dense::map<std::string, dcon::commodity_id> map_of_commodity_names;
-	ankerl::unordered_dense::map<std::string, dcon::factory_type_id> map_of_production_types;
-	ankerl::unordered_dense::map<std::string, dcon::factory_type_id> map_of_factory_names;
-	ankerl::unordered_dense::map<std::string, pending_ideology_content> map_of_ideologies;
-	ankerl::unordered_dense::map<std::string, dcon::ideology_group_id> map_of_ideology_groups;
-	ankerl::unordered_dense::map<std::string, pending_option_content> map_of_ioptions;
-	ankerl::unordered_dense::map<std::string, pending_roption_content> map_of_roptions;
-	ankerl::unordered_dense::map<std::string, dcon::issue_id> map_of_iissues;
-	ankerl::unordered_dense::map<std::string, dcon::reform_id> map_of_reforms;
-	ankerl::unordered_dense::map<std::string, dcon::government_type_id> map_of_governments;
-	ankerl::unordered_dense::map<std::string, pending_cb_content> map_of_cb_types;
-	ankerl::unordered_dense::map<std::string, dcon::leader_trait_id> map_of_leader_traits;
-	ankerl::unordered_dense::map<std::string, pending_crime_content> map_of_crimes;
+	string_map<dcon::religion_id> map_of_religion_names;
+	string_map<dcon::culture_id> map_of_culture_names;
+	string_map<dcon::culture_group_id> map_of_culture_group_names;
+	string_map<dcon::commodity_id> map_of_commodity_names;
+	string_map<dcon::factory_type_id> map_of_production_types;
+	string_map<dcon::factory_type_id> map_of_factory_names;
+	string_map<pending_ideology_content> map_of_ideologies;
+	string_map<dcon::ideology_group_id> map_of_ideology_groups;
+	string_map<pending_option_content> map_of_ioptions;
+	string_map<pending_roption_content> map_of_roptions;
+	string_map<dcon::issue_id> map_of_iissues;
+	string_map<dcon::reform_id> map_of_reforms;
+	string_map<dcon::government_type_id> map_of_governments;
+	string_map<pending_cb_content> map_of_cb_types;
+	string_map<dcon::leader_trait_id> map_of_leader_traits;
+	string_map<pending_crime_content> map_of_crimes;
 	std::vector<pending_triggered_modifier_content> set_of_triggered_modifiers;
-	ankerl::unordered_dense::map<std::string, dcon::modifier_id> map_of_modifiers;
-	ankerl::unordered_dense::map<std::string, dcon::pop_type_id> map_of_poptypes;
-	ankerl::unordered_dense::map<std::string, pending_rebel_type_content> map_of_rebeltypes;
-	ankerl::unordered_dense::map<std::string, terrain_type> map_of_terrain_types;
-	ankerl::unordered_dense::map<std::string, int32_t> map_of_tech_folders;
-	ankerl::unordered_dense::map<std::string, pending_tech_content> map_of_technologies;
-	ankerl::unordered_dense::map<std::string, pending_invention_content> map_of_inventions;
-	ankerl::unordered_dense::map<std::string, dcon::unit_type_id> map_of_unit_types;
-	ankerl::unordered_dense::map<std::string, dcon::national_variable_id> map_of_national_variables;
-	ankerl::unordered_dense::map<std::string, dcon::national_flag_id> map_of_national_flags;
-	ankerl::unordered_dense::map<std::string, dcon::global_flag_id> map_of_global_flags;
-	ankerl::unordered_dense::map<std::string, dcon::state_definition_id> map_of_state_names;
-	ankerl::unordered_dense::map<std::string, dcon::region_id> map_of_region_names;
+	string_map<dcon::modifier_id> map_of_modifiers;
+	string_map<dcon::pop_type_id> map_of_poptypes;
+	string_map<pending_rebel_type_content> map_of_rebeltypes;
+	string_map<terrain_type> map_of_terrain_types;
+	string_map<int32_t> map_of_tech_folders;
+	string_map<pending_tech_content> map_of_technologies;
+	string_map<pending_invention_content> map_of_inventions;
+	string_map<dcon::unit_type_id> map_of_unit_types;
+	string_map<dcon::national_variable_id> map_of_national_variables;
+	string_map<dcon::national_flag_id> map_of_national_flags;
+	string_map<dcon::global_flag_id> map_of_global_flags;
+	string_map<dcon::state_definition_id> map_of_state_names;
+	string_map<dcon::region_id> map_of_region_names;
 	ankerl::unordered_dense::map<int32_t, pending_nat_event> map_of_national_events;
 	ankerl::unordered_dense::map<int32_t, pending_prov_event> map_of_provincial_events;
-	ankerl::unordered_dense::map<std::string, dcon::leader_images_id> map_of_leader_graphics;
+	std::vector<std::string> event_file_names = { std::string() }; // the files pending events were read from
+	string_map<dcon::leader_images_id> map_of_leader_graphics;
 
 	tagged_vector<province_data, dcon::province_id> prov_id_to_original_id_map;
 	std::vector<dcon::province_id> original_id_to_prov_id_map;
@@ -383,9 +398,10 @@ struct scenario_building_context {
 
 	scenario_building_context(sys::state& state);
 
-	dcon::national_variable_id get_national_variable(std::string const& name);
-	dcon::national_flag_id get_national_flag(std::string const& name);
-	dcon::global_flag_id get_global_flag(std::string const& name);
+	dcon::national_variable_id get_national_variable(std::string_view name);
+	dcon::national_flag_id get_national_flag(std::string_view name);
+	dcon::global_flag_id get_global_flag(std::string_view name);
+	uint32_t get_event_file_name(std::string const& name);
 
 	int32_t number_of_commodities_seen = 0;
 	int32_t number_of_national_values_seen = 0;
@@ -957,7 +973,7 @@ struct commodity_array {
 
 	void any_value(std::string_view name, association_type, float value, error_handler& err, int32_t line,
 			scenario_building_context& context) {
-		auto found_commodity = context.map_of_commodity_names.find(std::string(name));
+		auto found_commodity = context.map_of_commodity_names.find(name);
 		if(found_commodity != context.map_of_commodity_names.end()) {
 			data.safe_get(found_commodity->second) = value;
 		} else {
@@ -1432,7 +1448,7 @@ struct pv_party_loyalty {
 	int32_t loyalty_value = 0;
 	dcon::ideology_id id;
 	void ideology(association_type, std::string_view text, error_handler& err, int32_t line, province_file_context& context) {
-		if(auto it = context.outer_context.map_of_ideologies.find(std::string(text));
+		if(auto it = context.outer_context.map_of_ideologies.find(text);
 				it != context.outer_context.map_of_ideologies.end()) {
 			id = it->second.id;
 		} else {
@@ -1446,7 +1462,7 @@ struct pv_state_building {
 	int32_t level = 1;
 	dcon::factory_type_id id;
 	void building(association_type, std::string_view text, error_handler& err, int32_t line, province_file_context& context) {
-		if(auto it = context.outer_context.map_of_factory_names.find(std::string(text));
+		if(auto it = context.outer_context.map_of_factory_names.find(text);
 				it != context.outer_context.map_of_factory_names.end()) {
 			id = it->second;
 		} else {
@@ -2263,7 +2279,7 @@ struct oob_leader {
 			err.accumulated_errors += "Leader of type neither land nor sea (" + err.file_name + " line " + std::to_string(line) + ")\n";
 	}
 	void personality(association_type, std::string_view value, error_handler& err, int32_t line, oob_file_context& context) {
-		if(auto it = context.outer_context.map_of_leader_traits.find(std::string(value));
+		if(auto it = context.outer_context.map_of_leader_traits.find(value);
 				it != context.outer_context.map_of_leader_traits.end()) {
 			personality_ = it->second;
 		} else {
@@ -2272,7 +2288,7 @@ struct oob_leader {
 		}
 	}
 	void background(association_type, std::string_view value, error_handler& err, int32_t line, oob_file_context& context) {
-		if(auto it = context.outer_context.map_of_leader_traits.find(std::string(value));
+		if(auto it = context.outer_context.map_of_leader_traits.find(value);
 				it != context.outer_context.map_of_leader_traits.end()) {
 			background_ = it->second;
 		} else {
@@ -2328,7 +2344,7 @@ struct production_type;
 
 struct production_context {
 	scenario_building_context& outer_context;
-	ankerl::unordered_dense::map<std::string, production_type> templates;
+	string_map<production_type> templates;
 	bool found_worker_types = false;
 
 	production_context(scenario_building_context& outer_context) : outer_context(outer_context) { }
@@ -2377,7 +2393,7 @@ struct production_type {
 	production_type_enum type_ = production_type_enum::none;
 
 	void output_goods(association_type, std::string_view v, error_handler& err, int32_t line, production_context& context) {
-		if(auto it = context.outer_context.map_of_commodity_names.find(std::string(v));
+		if(auto it = context.outer_context.map_of_commodity_names.find(v);
 				it != context.outer_context.map_of_commodity_names.end()) {
 			output_goods_ = it->second;
 		} else {
@@ -2400,7 +2416,7 @@ struct production_type {
 					"Invalid production type " + std::string(v) + " (" + err.file_name + " line " + std::to_string(line) + ")\n";
 	}
 	void as_template(association_type, std::string_view v, error_handler& err, int32_t line, production_context& context) {
-		if(auto it = context.templates.find(std::string(v)); it != context.templates.end()) {
+		if(auto it = context.templates.find(v); it != context.templates.end()) {
 			*this = it->second;
 		} else {
 			err.accumulated_errors +=
@@ -2456,7 +2472,7 @@ struct govt_flag_block {
 
 	void flag(association_type, std::string_view value, error_handler& err, int32_t line, country_history_context& context);
 	void government(association_type, std::string_view value, error_handler& err, int32_t line, country_history_context& context) {
-		if(auto it = context.outer_context.map_of_governments.find(std::string(value));
+		if(auto it = context.outer_context.map_of_governments.find(value);
 				it != context.outer_context.map_of_governments.end()) {
 			government_ = it->second;
 		} else {
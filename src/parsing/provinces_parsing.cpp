@@ -112,7 +112,7 @@ void read_map_adjacency(char const* start, char const* end, error_handler& err,
 
 void palette_definition::finish(scenario_building_context& context) {
 	if(color.free_value == 254) {
-		auto it = context.map_of_terrain_types.find(std::string(type));
+		auto it = context.map_of_terrain_types.find(type);
 		if(it != context.map_of_terrain_types.end()) {
 			context.ocean_terrain = it->second.id;
 		}
@@ -121,7 +121,7 @@ void palette_definition::finish(scenario_building_context& context) {
 	if(color.free_value < 0 || color.free_value >= 64)
 		return;
 
-	auto it = context.map_of_terrain_types.find(std::string(type));
+	auto it = context.map_of_terrain_types.find(type);
 	if(it != context.map_of_terrain_types.end()) {
 		context.color_by_terrain_index[color.free_value] = it->second.color;
 		context.modifier_by_terrain_index[color.free_value] = it->second.id;
@@ -211,7 +211,7 @@ void make_climate_definition(std::string_view name, token_generator& gen, error_
 	auto name_id = text::find_or_add_key(context.state, name);
 
 	auto new_modifier = [&]() {
-		if(auto it = context.map_of_modifiers.find(std::string(name)); it != context.map_of_modifiers.end())
+		if(auto it = context.map_of_modifiers.find(name); it != context.map_of_modifiers.end())
 			return it->second;
 
 		auto new_id = context.state.world.create_modifier();
@@ -267,7 +267,7 @@ void province_history_file::colony(association_type, uint32_t value, error_handl
 
 void province_history_file::trade_goods(association_type, std::string_view text, error_handler& err, int32_t line,
 		province_file_context& context) {
-	if(auto it = context.outer_context.map_of_commodity_names.find(std::string(text));
+	if(auto it = context.outer_context.map_of_commodity_names.find(text);
 			it != context.outer_context.map_of_commodity_names.end()) {
 		context.outer_context.state.world.province_set_rgo(context.id, it->second);
 	} else {
@@ -297,7 +297,7 @@ void province_history_file::controller(association_type, uint32_t value, error_h
 
 void province_history_file::terrain(association_type, std::string_view text, error_handler& err, int32_t line,
 		province_file_context& context) {
-	if(auto it = context.outer_context.map_of_terrain_types.find(std::string(text));
+	if(auto it = context.outer_context.map_of_terrain_types.find(text);
 			it != context.outer_context.map_of_terrain_types.end()) {
 		context.outer_context.state.world.province_set_terrain(context.id, it->second.id);
 	} else {
@@ -275,7 +275,7 @@ struct tr_can_build_railway_in_capital {
 struct tr_work_available {
 	std::vector<dcon::pop_type_id> pop_type_list;
 	void worker(association_type, std::string_view value, error_handler& err, int32_t line, trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_poptypes.find(std::string(value));
+		if(auto it = context.outer_context.map_of_poptypes.find(value);
 				it != context.outer_context.map_of_poptypes.end()) {
 			pop_type_list.push_back(it->second);
 		} else {
@@ -1423,7 +1423,7 @@ struct trigger_body {
 	void invention(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
 
-		if(auto it = context.outer_context.map_of_technologies.find(std::string(value));
+		if(auto it = context.outer_context.map_of_technologies.find(value);
 				it != context.outer_context.map_of_technologies.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::technology | association_to_bool_code(a)));
@@ -1440,7 +1440,7 @@ struct trigger_body {
 
 			context.compiled_trigger.push_back(uint16_t(1 + 1)); // data size; if no payload add code | trigger_codes::no_payload
 			context.compiled_trigger.push_back(trigger::payload(it->second.id).value);
-		} else if(auto itb = context.outer_context.map_of_inventions.find(std::string(value));
+		} else if(auto itb = context.outer_context.map_of_inventions.find(value);
 							itb != context.outer_context.map_of_inventions.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::invention | association_to_bool_code(a)));
@@ -1463,7 +1463,7 @@ struct trigger_body {
 	}
 	void big_producer(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_commodity_names.find(std::string(value));
+		if(auto it = context.outer_context.map_of_commodity_names.find(value);
 				it != context.outer_context.map_of_commodity_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::big_producer | association_to_bool_code(a)));
@@ -1630,7 +1630,7 @@ struct trigger_body {
 
 	void government(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_governments.find(std::string(value));
+		if(auto it = context.outer_context.map_of_governments.find(value);
 				it != context.outer_context.map_of_governments.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::government_nation | association_to_bool_code(a)));
@@ -1652,7 +1652,7 @@ struct trigger_body {
 
 	void constructing_cb_type(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_cb_types.find(std::string(value));
+		if(auto it = context.outer_context.map_of_cb_types.find(value);
 				it != context.outer_context.map_of_cb_types.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::constructing_cb_type | association_to_bool_code(a)));
@@ -1672,7 +1672,7 @@ struct trigger_body {
 
 	void can_build_factory_in_capital_state(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_factory_names.find(std::string(value));
+		if(auto it = context.outer_context.map_of_factory_names.find(value);
 				it != context.outer_context.map_of_factory_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::can_build_factory_in_capital_state | association_to_bool_code(a)));
@@ -1707,7 +1707,7 @@ struct trigger_body {
 	}
 	void tech_school(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+		if(auto it = context.outer_context.map_of_modifiers.find(value);
 				it != context.outer_context.map_of_modifiers.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::tech_school | association_to_bool_code(a)));
@@ -1762,7 +1762,7 @@ struct trigger_body {
 					std::to_string(line) + ")\n";
 				return;
 			}
-		} else if(auto it = context.outer_context.map_of_culture_names.find(std::string(value)); it != context.outer_context.map_of_culture_names.end()) {
+		} else if(auto it = context.outer_context.map_of_culture_names.find(value); it != context.outer_context.map_of_culture_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::primary_culture | association_to_bool_code(a)));
 			} else if(context.main_slot == trigger::slot_contents::pop) {
@@ -1785,7 +1785,7 @@ struct trigger_body {
 	}
 	void has_crime(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_crimes.find(std::string(value)); it != context.outer_context.map_of_crimes.end()) {
+		if(auto it = context.outer_context.map_of_crimes.find(value); it != context.outer_context.map_of_crimes.end()) {
 			if(context.main_slot == trigger::slot_contents::province) {
 				context.compiled_trigger.push_back(uint16_t(trigger::has_crime | association_to_bool_code(a)));
 			} else {
@@ -1803,7 +1803,7 @@ struct trigger_body {
 	}
 	void accepted_culture(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_culture_names.find(std::string(value));
+		if(auto it = context.outer_context.map_of_culture_names.find(value);
 				it != context.outer_context.map_of_culture_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::accepted_culture | association_to_bool_code(a)));
@@ -1828,7 +1828,7 @@ struct trigger_body {
 				err.accumulated_errors += "pop_majority_religion = THIS trigger used in an incorrect scope type " + slot_contents_to_string(context.main_slot) + " (" + err.file_name + ", line " + std::to_string(line) + ")\n";
 				return;
 			}
-		} else if(auto it = context.outer_context.map_of_religion_names.find(std::string(value)); it != context.outer_context.map_of_religion_names.end()) {
+		} else if(auto it = context.outer_context.map_of_religion_names.find(value); it != context.outer_context.map_of_religion_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::pop_majority_religion_nation | association_to_bool_code(a)));
 			} else if(context.main_slot == trigger::slot_contents::state) {
@@ -1846,7 +1846,7 @@ struct trigger_body {
 		}
 	}
 	void pop_majority_culture(association_type a, std::string_view value, error_handler& err, int32_t line, trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_culture_names.find(std::string(value));
+		if(auto it = context.outer_context.map_of_culture_names.find(value);
 				it != context.outer_context.map_of_culture_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::pop_majority_culture_nation | association_to_bool_code(a)));
@@ -1867,7 +1867,7 @@ struct trigger_body {
 		}
 	}
 	void pop_majority_issue(association_type a, std::string_view value, error_handler& err, int32_t line, trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_ioptions.find(std::string(value));
+		if(auto it = context.outer_context.map_of_ioptions.find(value);
 				it != context.outer_context.map_of_ioptions.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::pop_majority_issue_nation | association_to_bool_code(a)));
@@ -1890,7 +1890,7 @@ struct trigger_body {
 		}
 	}
 	void pop_majority_ideology(association_type a, std::string_view value, error_handler& err, int32_t line, trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_ideologies.find(std::string(value));
+		if(auto it = context.outer_context.map_of_ideologies.find(value);
 				it != context.outer_context.map_of_ideologies.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::pop_majority_ideology_nation | association_to_bool_code(a)));
@@ -1913,7 +1913,7 @@ struct trigger_body {
 		}
 	}
 	void trade_goods_in_state(association_type a, std::string_view value, error_handler& err, int32_t line, trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_commodity_names.find(std::string(value));
+		if(auto it = context.outer_context.map_of_commodity_names.find(value);
 				it != context.outer_context.map_of_commodity_names.end()) {
 			if(context.main_slot == trigger::slot_contents::state) {
 				context.compiled_trigger.push_back(uint16_t(trigger::trade_goods_in_state_state | association_to_bool_code(a)));
@@ -2004,7 +2004,7 @@ struct trigger_body {
 																	std::to_string(line) + ")\n";
 				return;
 			}
-		} else if(auto it = context.outer_context.map_of_culture_names.find(std::string(value)); it != context.outer_context.map_of_culture_names.end()) {
+		} else if(auto it = context.outer_context.map_of_culture_names.find(value); it != context.outer_context.map_of_culture_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::culture_nation | association_to_bool_code(a)));
 			} else if(context.main_slot == trigger::slot_contents::state) {
@@ -2053,7 +2053,7 @@ struct trigger_body {
 																	std::to_string(line) + ")\n";
 				return;
 			}
-		} else if(auto it = context.outer_context.map_of_culture_names.find(std::string(value));
+		} else if(auto it = context.outer_context.map_of_culture_names.find(value);
 							it != context.outer_context.map_of_culture_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::has_pop_culture_nation | association_to_bool_code(a)));
@@ -2103,7 +2103,7 @@ struct trigger_body {
 																	std::to_string(line) + ")\n";
 				return;
 			}
-		} else if(auto it = context.outer_context.map_of_religion_names.find(std::string(value));
+		} else if(auto it = context.outer_context.map_of_religion_names.find(value);
 							it != context.outer_context.map_of_religion_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::has_pop_religion_nation | association_to_bool_code(a)));
@@ -2227,7 +2227,7 @@ struct trigger_body {
 																	std::to_string(line) + ")\n";
 				return;
 			}
-		} else if(auto it = context.outer_context.map_of_culture_group_names.find(std::string(value));
+		} else if(auto it = context.outer_context.map_of_culture_group_names.find(value);
 							it != context.outer_context.map_of_culture_group_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::culture_group_nation | association_to_bool_code(a)));
@@ -2349,7 +2349,7 @@ struct trigger_body {
 																	std::to_string(line) + ")\n";
 				return;
 			}
-		} else if(auto it = context.outer_context.map_of_religion_names.find(std::string(value));
+		} else if(auto it = context.outer_context.map_of_religion_names.find(value);
 							it != context.outer_context.map_of_religion_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::religion_nation | association_to_bool_code(a)));
@@ -2368,7 +2368,7 @@ struct trigger_body {
 		}
 	}
 	void terrain(association_type a, std::string_view value, error_handler& err, int32_t line, trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_terrain_types.find(std::string(value));
+		if(auto it = context.outer_context.map_of_terrain_types.find(value);
 				it != context.outer_context.map_of_terrain_types.end()) {
 			if(context.main_slot == trigger::slot_contents::pop) {
 				context.compiled_trigger.push_back(uint16_t(trigger::terrain_pop | association_to_bool_code(a)));
@@ -2388,7 +2388,7 @@ struct trigger_body {
 	}
 	void trade_goods(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_commodity_names.find(std::string(value));
+		if(auto it = context.outer_context.map_of_commodity_names.find(value);
 				it != context.outer_context.map_of_commodity_names.end()) {
 			if(context.main_slot == trigger::slot_contents::province) {
 				context.compiled_trigger.push_back(uint16_t(trigger::trade_goods | association_to_bool_code(a)));
@@ -2420,7 +2420,7 @@ struct trigger_body {
 	}
 	void has_faction(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_rebeltypes.find(std::string(value));
+		if(auto it = context.outer_context.map_of_rebeltypes.find(value);
 				it != context.outer_context.map_of_rebeltypes.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::has_faction_nation | association_to_bool_code(a)));
@@ -2640,7 +2640,7 @@ struct trigger_body {
 					"owns trigger given an invalid province id (" + err.file_name + ", line " + std::to_string(line) + ")\n";
 				context.compiled_trigger.push_back(trigger::payload(dcon::province_id()).value);
 			}
-		} else if(auto it = context.outer_context.map_of_state_names.find(std::string(v)); it != context.outer_context.map_of_state_names.end()) {
+		} else if(auto it = context.outer_context.map_of_state_names.find(v); it != context.outer_context.map_of_state_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::owns_region | association_to_bool_code(a)));
 				context.compiled_trigger.push_back(trigger::payload(it->second).value);
@@ -2649,7 +2649,7 @@ struct trigger_body {
 					"(" + err.file_name + ", line " + std::to_string(line) + ")\n";
 				return;
 			}
-		} else if(auto it = context.outer_context.map_of_region_names.find(std::string(v)); it != context.outer_context.map_of_region_names.end()) {
+		} else if(auto it = context.outer_context.map_of_region_names.find(v); it != context.outer_context.map_of_region_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::owns_region_proper | association_to_bool_code(a)));
 				context.compiled_trigger.push_back(trigger::payload(it->second).value);
@@ -3026,12 +3026,12 @@ struct trigger_body {
 																std::to_string(line) + ")\n";
 			return;
 		}
-		context.compiled_trigger.push_back(trigger::payload(context.outer_context.get_national_flag(std::string(value))).value);
+		context.compiled_trigger.push_back(trigger::payload(context.outer_context.get_national_flag(value)).value);
 	}
 	void has_global_flag(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
 		context.compiled_trigger.push_back(uint16_t(trigger::has_global_flag | association_to_bool_code(a)));
-		context.compiled_trigger.push_back(trigger::payload(context.outer_context.get_global_flag(std::string(value))).value);
+		context.compiled_trigger.push_back(trigger::payload(context.outer_context.get_global_flag(value)).value);
 	}
 
 	void continent(association_type a, std::string_view value, error_handler& err, int32_t line,
@@ -3057,7 +3057,7 @@ struct trigger_body {
 																		std::to_string(line) + ")\n";
 					return;
 				}
-			} else if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+			} else if(auto it = context.outer_context.map_of_modifiers.find(value);
 								it != context.outer_context.map_of_modifiers.end()) {
 				context.compiled_trigger.push_back(uint16_t(trigger::continent_nation | association_to_bool_code(a)));
 				context.compiled_trigger.push_back(trigger::payload(it->second).value);
@@ -3087,7 +3087,7 @@ struct trigger_body {
 																		std::to_string(line) + ")\n";
 					return;
 				}
-			} else if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+			} else if(auto it = context.outer_context.map_of_modifiers.find(value);
 								it != context.outer_context.map_of_modifiers.end()) {
 				context.compiled_trigger.push_back(uint16_t(trigger::continent_state | association_to_bool_code(a)));
 				context.compiled_trigger.push_back(trigger::payload(it->second).value);
@@ -3117,7 +3117,7 @@ struct trigger_body {
 																		std::to_string(line) + ")\n";
 					return;
 				}
-			} else if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+			} else if(auto it = context.outer_context.map_of_modifiers.find(value);
 								it != context.outer_context.map_of_modifiers.end()) {
 				context.compiled_trigger.push_back(uint16_t(trigger::continent_province | association_to_bool_code(a)));
 				context.compiled_trigger.push_back(trigger::payload(it->second).value);
@@ -3147,7 +3147,7 @@ struct trigger_body {
 																		std::to_string(line) + ")\n";
 					return;
 				}
-			} else if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+			} else if(auto it = context.outer_context.map_of_modifiers.find(value);
 								it != context.outer_context.map_of_modifiers.end()) {
 				context.compiled_trigger.push_back(uint16_t(trigger::continent_pop | association_to_bool_code(a)));
 				context.compiled_trigger.push_back(trigger::payload(it->second).value);
@@ -3320,7 +3320,7 @@ struct trigger_body {
 			if(is_fixed_token_ci(value.data(), value.data() + value.length(), "factory")) {
 				context.compiled_trigger.push_back(
 						uint16_t(trigger::has_building_factory | trigger::no_payload | association_to_bool_code(a)));
-			}  else if(auto it = context.outer_context.map_of_factory_names.find(std::string(value));
+			}  else if(auto it = context.outer_context.map_of_factory_names.find(value);
 							it != context.outer_context.map_of_factory_names.end()) {
 				context.compiled_trigger.push_back(uint16_t(trigger::has_building_state | association_to_bool_code(a)));
 				context.compiled_trigger.push_back(trigger::payload(it->second).value);
@@ -3356,7 +3356,7 @@ struct trigger_body {
 				|| is_fixed_token_ci(value.data(), value.data() + value.length(), "province_immigrator")) {
 				context.compiled_trigger.push_back(uint16_t(trigger::has_province_modifier | association_to_bool_code(a)));
 				context.compiled_trigger.push_back(trigger::payload(economy::get_province_immigrator_modifier(context.outer_context.state)).value);
-			} else if(auto it = context.outer_context.map_of_factory_names.find(std::string(value));
+			} else if(auto it = context.outer_context.map_of_factory_names.find(value);
 								it != context.outer_context.map_of_factory_names.end()) {
 				context.compiled_trigger.push_back(uint16_t(trigger::has_building_state_from_province | association_to_bool_code(a)));
 				context.compiled_trigger.push_back(trigger::payload(it->second).value);
@@ -3397,7 +3397,7 @@ struct trigger_body {
 
 	void has_country_modifier(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+		if(auto it = context.outer_context.map_of_modifiers.find(value);
 				it != context.outer_context.map_of_modifiers.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::has_country_modifier | association_to_bool_code(a)));
@@ -3417,7 +3417,7 @@ struct trigger_body {
 	}
 	void has_province_modifier(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+		if(auto it = context.outer_context.map_of_modifiers.find(value);
 				it != context.outer_context.map_of_modifiers.end()) {
 			if(context.main_slot == trigger::slot_contents::province) {
 				context.compiled_trigger.push_back(uint16_t(trigger::has_province_modifier | association_to_bool_code(a)));
@@ -3435,7 +3435,7 @@ struct trigger_body {
 	}
 	void nationalvalue(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_modifiers.find(std::string(value));
+		if(auto it = context.outer_context.map_of_modifiers.find(value);
 				it != context.outer_context.map_of_modifiers.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::nationalvalue_nation | association_to_bool_code(a)));
@@ -3456,7 +3456,7 @@ struct trigger_body {
 		}
 	}
 	void region(association_type a, std::string_view value, error_handler& err, int32_t line, trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_state_names.find(std::string(value)); it != context.outer_context.map_of_state_names.end()) {
+		if(auto it = context.outer_context.map_of_state_names.find(value); it != context.outer_context.map_of_state_names.end()) {
 			if(context.main_slot == trigger::slot_contents::province) {
 				context.compiled_trigger.push_back(uint16_t(trigger::region | association_to_bool_code(a)));
 			} else if(context.main_slot == trigger::slot_contents::state) {
@@ -3469,7 +3469,7 @@ struct trigger_body {
 				return;
 			}
 			context.compiled_trigger.push_back(trigger::payload(it->second).value);
-		} else if(auto it = context.outer_context.map_of_region_names.find(std::string(value)); it != context.outer_context.map_of_region_names.end()) {
+		} else if(auto it = context.outer_context.map_of_region_names.find(value); it != context.outer_context.map_of_region_names.end()) {
 			if(context.main_slot == trigger::slot_contents::province) {
 				context.compiled_trigger.push_back(uint16_t(trigger::region_proper | association_to_bool_code(a)));
 			} else if(context.main_slot == trigger::slot_contents::state) {
@@ -3933,7 +3933,7 @@ struct trigger_body {
 	}
 	void ruling_party_ideology(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_ideologies.find(std::string(value));
+		if(auto it = context.outer_context.map_of_ideologies.find(value);
 				it != context.outer_context.map_of_ideologies.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::ruling_party_ideology_nation | association_to_bool_code(a)));
@@ -3959,7 +3959,7 @@ struct trigger_body {
 			trigger_building_context& context);
 	void is_ideology_enabled(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_ideologies.find(std::string(value));
+		if(auto it = context.outer_context.map_of_ideologies.find(value);
 				it != context.outer_context.map_of_ideologies.end()) {
 			context.compiled_trigger.push_back(uint16_t(trigger::is_ideology_enabled | association_to_bool_code(a)));
 			context.compiled_trigger.push_back(trigger::payload(it->second.id).value);
@@ -4133,7 +4133,7 @@ struct trigger_body {
 					std::to_string(line) + ")\n";
 				return;
 			}
-		} else if(auto it = context.outer_context.map_of_culture_names.find(std::string(value)); it != context.outer_context.map_of_culture_names.end()) {
+		} else if(auto it = context.outer_context.map_of_culture_names.find(value); it != context.outer_context.map_of_culture_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::primary_culture | association_to_bool_code(a)));
 			} else if(context.main_slot == trigger::slot_contents::pop) {
@@ -4247,7 +4247,7 @@ struct trigger_body {
 					std::to_string(line) + ")\n";
 				return;
 			}
-		} else if(auto it = context.outer_context.map_of_culture_names.find(std::string(value)); it != context.outer_context.map_of_culture_names.end()) {
+		} else if(auto it = context.outer_context.map_of_culture_names.find(value); it != context.outer_context.map_of_culture_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::accepted_culture | association_to_bool_code(a)));
 			} else {
@@ -4343,7 +4343,7 @@ struct trigger_body {
 		}
 	}
 	void produces(association_type a, std::string_view value, error_handler& err, int32_t line, trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_commodity_names.find(std::string(value));
+		if(auto it = context.outer_context.map_of_commodity_names.find(value);
 				it != context.outer_context.map_of_commodity_names.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::produces_nation | association_to_bool_code(a)));
@@ -4365,7 +4365,7 @@ struct trigger_body {
 	}
 	void has_pop_type(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_poptypes.find(std::string(value));
+		if(auto it = context.outer_context.map_of_poptypes.find(value);
 				it != context.outer_context.map_of_poptypes.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::has_pop_type_nation | association_to_bool_code(a)));
@@ -4435,7 +4435,7 @@ struct trigger_body {
 	}
 	void is_next_reform(association_type a, std::string_view value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_ioptions.find(std::string(value));
+		if(auto it = context.outer_context.map_of_ioptions.find(value);
 				it != context.outer_context.map_of_ioptions.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::is_next_reform_nation | association_to_bool_code(a)));
@@ -4448,7 +4448,7 @@ struct trigger_body {
 				return;
 			}
 			context.compiled_trigger.push_back(trigger::payload(it->second.id).value);
-		} else if(auto itb = context.outer_context.map_of_roptions.find(std::string(value));
+		} else if(auto itb = context.outer_context.map_of_roptions.find(value);
 							itb != context.outer_context.map_of_roptions.end()) {
 			if(context.main_slot == trigger::slot_contents::nation) {
 				context.compiled_trigger.push_back(uint16_t(trigger::is_next_rreform_nation | association_to_bool_code(a)));
@@ -5388,7 +5388,7 @@ struct trigger_body {
 				return;
 			}
 			context.add_float_to_payload(value.value_);
-		} else if(auto it = context.outer_context.map_of_poptypes.find(std::string(value.type));
+		} else if(auto it = context.outer_context.map_of_poptypes.find(value.type);
 							it != context.outer_context.map_of_poptypes.end()) {
 			if(context.main_slot == trigger::slot_contents::nation)
 				context.compiled_trigger.push_back(uint16_t(trigger::pop_unemployment_nation | association_to_trigger_code(value.a)));
@@ -5461,10 +5461,10 @@ struct trigger_body {
 		context.compiled_trigger.push_back(uint16_t(trigger::check_variable | association_to_trigger_code(value.a)));
 		context.add_float_to_payload(value.value_);
 		context.compiled_trigger.push_back(
-				trigger::payload(context.outer_context.get_national_variable(std::string(value.which))).value);
+				trigger::payload(context.outer_context.get_national_variable(value.which)).value);
 	}
 	void upper_house(tr_upper_house const& value, error_handler& err, int32_t line, trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_ideologies.find(std::string(value.ideology));
+		if(auto it = context.outer_context.map_of_ideologies.find(value.ideology);
 				it != context.outer_context.map_of_ideologies.end()) {
 			if(context.main_slot != trigger::slot_contents::nation) {
 				err.accumulated_errors +=
@@ -5482,7 +5482,7 @@ struct trigger_body {
 	}
 	void unemployment_by_type(tr_unemployment_by_type const& value, error_handler& err, int32_t line,
 			trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_poptypes.find(std::string(value.type));
+		if(auto it = context.outer_context.map_of_poptypes.find(value.type);
 				it != context.outer_context.map_of_poptypes.end()) {
 			if(context.main_slot == trigger::slot_contents::nation)
 				context.compiled_trigger.push_back(uint16_t(trigger::unemployment_by_type_nation | association_to_trigger_code(value.a)));
@@ -5508,7 +5508,7 @@ struct trigger_body {
 	}
 
 	void party_loyalty(tr_party_loyalty const& value, error_handler& err, int32_t line, trigger_building_context& context) {
-		if(auto it = context.outer_context.map_of_ideologies.find(std::string(value.ideology));
+		if(auto it = context.outer_context.map_of_ideologies.find(value.ideology);
 				it != context.outer_context.map_of_ideologies.end()) {
 			if(value.province_id != 0) {
 				if(0 <= value.province_id && size_t(value.province_id) < context.outer_context.original_id_to_prov_id_map.size()) {
@@ -5790,7 +5790,7 @@ struct trigger_body {
 			context.compiled_trigger.push_back(trigger::payload(itg->second.id).value);
 			context.add_float_to_payload(parse_float(value, line, err) / 100.0f);
 		} else if(auto itf = context.outer_context.map_of_iissues.find(str_label); itf != context.outer_context.map_of_iissues.end()) {
-			if(auto itopt = context.outer_context.map_of_ioptions.find(std::string(value));
+			if(auto itopt = context.outer_context.map_of_ioptions.find(value);
 					itopt != context.outer_context.map_of_ioptions.end()) {
 				if(context.main_slot == trigger::slot_contents::nation)
 					context.compiled_trigger.push_back(uint16_t(trigger::variable_issue_group_name_nation | association_to_bool_code(a)));
@@ -5813,7 +5813,7 @@ struct trigger_body {
 				return;
 			}
 		} else if(auto ith = context.outer_context.map_of_reforms.find(str_label); ith != context.outer_context.map_of_reforms.end()) {
-			if(auto itopt = context.outer_context.map_of_roptions.find(std::string(value));
+			if(auto itopt = context.outer_context.map_of_roptions.find(value);
 					itopt != context.outer_context.map_of_roptions.end()) {
 				if(context.main_slot == trigger::slot_contents::nation)
 					context.compiled_trigger.push_back(uint16_t(trigger::variable_reform_group_name_nation | association_to_bool_code(a)));
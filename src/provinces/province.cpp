@@ -58,6 +58,43 @@ void for_each_province_in_state_instance(sys::state& state, dcon::state_instance
 		}
 	}
 }
+inline int32_t spatial_cell_coordinate(float v) {
+	auto c = int32_t((v + 1.0f) * (float(spatial_cells_per_axis) / 2.0f));
+	return std::clamp(c, 0, spatial_cells_per_axis - 1);
+}
+
+template<typename F>
+void for_each_province_within(sys::state& state, dcon::province_id center, float max_sorting_distance, F const& func) {
+	auto chord_sq = 2.0f + 2.0f * max_sorting_distance;
+	if(chord_sq <= 0.0f)
+		return;
+
+	auto& cell_start = state.province_definitions.spatial_cell_start;
+	auto& contents = state.province_definitions.spatial_cell_contents;
+	constexpr int32_t n = spatial_cells_per_axis;
+
+	auto pos = state.world.province_get_mid_point_b(center);
+	auto chord = math::sqrt(chord_sq);
+	int32_t x0 = spatial_cell_coordinate(pos.x - chord), x1 = spatial_cell_coordinate(pos.x + chord);
+	int32_t y0 = spatial_cell_coordinate(pos.y - chord), y1 = spatial_cell_coordinate(pos.y + chord);
+	int32_t z0 = spatial_cell_coordinate(pos.z - chord), z1 = spatial_cell_coordinate(pos.z + chord);
+
+	for(int32_t x = x0; x <= x1; ++x) {
+		for(int32_t y = y0; y <= y1; ++y) {
+			for(int32_t z = z0; z <= z1; ++z) {
+				auto cell = uint32_t((x * n + y) * n + z);
+				for(uint32_t i = cell_start[cell]; i < cell_start[cell + 1]; ++i) {
+					auto p = contents[i];
+					auto ppos = state.world.province_get_mid_point_b(p);
+					auto d = -((pos.x * ppos.x + pos.y * ppos.y) + pos.z * ppos.z);
+					if(d < max_sorting_distance)
+						func(p);
+				}
+			}
+		}
+	}
+}
+
 bool nations_are_adjacent(sys::state& state, dcon::nation_id a, dcon::nation_id b) {
 	auto it = state.world.get_nation_adjacency_by_nation_adjacency_pair(a, b);
 	return bool(it);
@@ -2158,10 +2195,36 @@ void restore_distances(sys::state& state) {
 
 		p.set_mid_point_b(new_world_pos);
 	}
+	build_spatial_index(state);
 	for(auto adj : state.world.in_province_adjacency) {
 		auto dist = direct_distance(state, adj.get_connected_provinces(0), adj.get_connected_provinces(1));
 		adj.set_distance(dist);
 	}
 }
 
+void build_spatial_index(sys::state& state) {
+	constexpr int32_t n = spatial_cells_per_axis;
+	auto& cell_start = state.province_definitions.spatial_cell_start;
+	auto& contents = state.province_definitions.spatial_cell_contents;
+
+	auto cell_of = [&](dcon::province_id p) {
+		auto pos = state.world.province_get_mid_point_b(p);
+		return uint32_t((spatial_cell_coordinate(pos.x) * n + spatial_cell_coordinate(pos.y)) * n + spatial_cell_coordinate(pos.z));
+	};
+
+	// counting sort: provinces within a cell stay in index order
+	cell_start.assign(size_t(n * n * n + 1), 0);
+	for(auto p : state.world.in_province) {
+		++cell_start[cell_of(p) + 1];
+	}
+	for(size_t i = 1; i < cell_start.size(); ++i) {
+		cell_start[i] += cell_start[i - 1];
+	}
+	contents.resize(state.world.province_size());
+	std::vector<uint32_t> fill(cell_start.begin(), cell_start.end() - 1);
+	for(auto p : state.world.in_province) {
+		contents[fill[cell_of(p)]++] = p;
+	}
+}
+
 } // namespace province
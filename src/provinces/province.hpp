@@ -17,10 +17,15 @@ inline constexpr dcon::province_id from_map_id(uint16_t id) {
 		return dcon::province_id(id - 1);
 }
 
+inline constexpr int32_t spatial_cells_per_axis = 32;
+
 struct global_provincial_state {
 	std::vector<dcon::province_adjacency_id> canals;
 	ankerl::unordered_dense::map<dcon::modifier_id, dcon::gfx_object_id, sys::modifier_hash> terrain_to_gfx_map;
 	std::vector<bool> connected_region_is_coastal;
+	// uniform grid over the unit cube bucketing provinces by mid_point_b; rebuilt with the distances, not saved
+	std::vector<uint32_t> spatial_cell_start;
+	std::vector<dcon::province_id> spatial_cell_contents;
 
 	dcon::province_id first_sea_province;
 	dcon::modifier_id europe;
@@ -39,6 +44,9 @@ template<typename F>
 void for_each_province_in_state_instance(sys::state& state, dcon::state_instance_id s, F const& func);
 template<typename F>
 void ve_for_each_land_province(sys::state& state, F const& func);
+// calls func(province_id) for every province whose sorting distance to `center` is less than max_sorting_distance (in no particular order)
+template<typename F>
+void for_each_province_within(sys::state& state, dcon::province_id center, float max_sorting_distance, F const& func);
 
 bool nations_are_adjacent(sys::state& state, dcon::nation_id a, dcon::nation_id b);
 void update_connected_regions(sys::state& state);
@@ -46,6 +54,7 @@ void update_cached_values(sys::state& state);
 void update_blockaded_cache(sys::state& state);
 void restore_unsaved_values(sys::state& state);
 void restore_distances(sys::state& state);
+void build_spatial_index(sys::state& state);
 
 template<typename T>
 auto is_overseas(sys::state const& state, T ids);
@@ -1247,7 +1247,9 @@ void font::make_glyph(char ch_in) {
 			glBindTexture(GL_TEXTURE_2D, textures[texture_number]);
 			glTexStorage2D(GL_TEXTURE_2D, 1, GL_R8, 64 * 8, 64 * 8);
 
-			// glClearTexImage(textures[texture_number], 0, GL_RED, GL_FLOAT, nullptr);
+			// glyphs are made on demand, so cells that have not been filled yet must read as empty when a neighbour is filtered
+			std::vector<uint8_t> empty_page(64 * 8 * 64 * 8, uint8_t(0));
+			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 64 * 8, 64 * 8, GL_RED, GL_UNSIGNED_BYTE, empty_page.data());
 
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
@@ -56,18 +56,29 @@ std::string lowercase_str(std::string_view sv) {
 	return result;
 }
 
-text_sequence create_text_sequence(sys::state& state, std::string_view content) {
+dcon::text_key add_to_pool(std::vector<char>& text_data, std::string_view new_text) {
+	auto start = text_data.size();
+	auto length = new_text.length();
+	if(length == 0)
+		return dcon::text_key();
+	text_data.resize(start + length + 1, char(0));
+	std::copy_n(new_text.data(), length, text_data.data() + start);
+	text_data.back() = 0;
+	return dcon::text_key(uint32_t(start));
+}
+
+text_sequence create_text_sequence(std::vector<char>& text_data, std::vector<text_component>& text_components, std::string_view content) {
 	char const* seq_start = content.data();
 	char const* seq_end = content.data() + content.size();
 	char const* section_start = seq_start;
 
-	const auto component_start_index = state.text_components.size();
+	const auto component_start_index = text_components.size();
 	for(char const* pos = seq_start; pos < seq_end;) {
 		bool colour_esc = false;
 		if(uint8_t(*pos) == 0xA7) {
 			if(section_start != pos) {
-				auto added_key = state.add_to_pool(std::string_view(section_start, pos - section_start));
-				state.text_components.emplace_back(added_key);
+				auto added_key = add_to_pool(text_data, std::string_view(section_start, pos - section_start));
+				text_components.emplace_back(added_key);
 			}
 			pos += 1;
 			section_start = pos;
@@ -75,37 +86,37 @@ text_sequence create_text_sequence(sys::state& state, std::string_view content)
 		} else if(pos + 2 < seq_end && uint8_t(*pos) == 0xEF && uint8_t(*(pos + 1)) == 0xBF && uint8_t(*(pos + 2)) == 0xBD &&
 							is_qmark_color(*(pos + 3))) {
 			if(section_start != pos) {
-				auto added_key = state.add_to_pool(std::string_view(section_start, pos - section_start));
-				state.text_components.emplace_back(added_key);
+				auto added_key = add_to_pool(text_data, std::string_view(section_start, pos - section_start));
+				text_components.emplace_back(added_key);
 			}
 			section_start = pos += 3;
 			colour_esc = true;
 		} else if(pos + 1 < seq_end && *pos == '?' && is_qmark_color(*(pos + 1))) {
 			if(section_start != pos) {
-				auto added_key = state.add_to_pool(std::string_view(section_start, pos - section_start));
-				state.text_components.emplace_back(added_key);
+				auto added_key = add_to_pool(text_data, std::string_view(section_start, pos - section_start));
+				text_components.emplace_back(added_key);
 			}
 			pos += 1;
 			section_start = pos;
 			colour_esc = true;
 		} else if(*pos == '$') {
 			if(section_start != pos) {
-				auto added_key = state.add_to_pool(std::string_view(section_start, pos - section_start));
-				state.text_components.emplace_back(added_key);
+				auto added_key = add_to_pool(text_data, std::string_view(section_start, pos - section_start));
+				text_components.emplace_back(added_key);
 			}
 			const char* vend = pos + 1;
 			for(; vend != seq_end && *vend != '$'; ++vend)
 				;
 			if(vend > pos + 1)
-				state.text_components.emplace_back(variable_type_from_name(std::string_view(pos + 1, vend - pos - 1)));
+				text_components.emplace_back(variable_type_from_name(std::string_view(pos + 1, vend - pos - 1)));
 			pos = vend + 1;
 			section_start = pos;
 		} else if(pos + 1 < seq_end && *pos == '\\' && *(pos + 1) == 'n') {
 			if(section_start != pos) {
-				auto added_key = state.add_to_pool(std::string_view(section_start, pos - section_start));
-				state.text_components.emplace_back(added_key);
+				auto added_key = add_to_pool(text_data, std::string_view(section_start, pos - section_start));
+				text_components.emplace_back(added_key);
 			}
-			state.text_components.emplace_back(line_break{});
+			text_components.emplace_back(line_break{});
 			section_start = pos += 2;
 		} else {
 			++pos;
@@ -114,27 +125,31 @@ text_sequence create_text_sequence(sys::state& state, std::string_view content)
 		// This colour escape sequence must be followed by something, otherwise
 		// we should probably discard the last colour command
 		if(colour_esc && pos < seq_end) {
-			state.text_components.emplace_back(char_to_color(*pos));
+			text_components.emplace_back(char_to_color(*pos));
 			pos += 1;
 			section_start = pos;
 		}
 	}
 
 	if(section_start < seq_end) {
-		auto added_key = state.add_to_pool(std::string_view(section_start, seq_end - section_start));
-		state.text_components.emplace_back(added_key);
+		auto added_key = add_to_pool(text_data, std::string_view(section_start, seq_end - section_start));
+		text_components.emplace_back(added_key);
 	}
 
 	// TODO: Emit error when 64K boundary is violated
-	assert(state.text_components.size() < std::numeric_limits<uint32_t>::max());
-	assert(state.text_components.size() - component_start_index < std::numeric_limits<uint8_t>::max());
+	assert(text_components.size() < std::numeric_limits<uint32_t>::max());
+	assert(text_components.size() - component_start_index < std::numeric_limits<uint8_t>::max());
 
 	return text_sequence{
 		static_cast<uint32_t>(component_start_index),
-		static_cast<uint16_t>(state.text_components.size() - component_start_index)
+		static_cast<uint16_t>(text_components.size() - component_start_index)
 	};
 }
 
+text_sequence create_text_sequence(sys::state& state, std::string_view content) {
+	return create_text_sequence(state.text_data, state.text_components, content);
+}
+
 dcon::text_sequence_id create_text_entry(sys::state& state, std::string_view key, std::string_view content) {
 	auto to_lower_temp = lowercase_str(key);
 	auto sequence_record = create_text_sequence(state, content);
@@ -142,6 +157,7 @@ dcon::text_sequence_id create_text_entry(sys::state& state, std::string_view key
 	if(auto it = state.key_to_text_sequence.find(to_lower_temp); it != state.key_to_text_sequence.end()) {
 		// maybe report an error here -- repeated definition
 		state.text_sequences[it->second] = sequence_record;
+		state.layout_cache.clear();
 		return it->second;
 	} else {
 		const auto nh = state.text_sequences.size();
@@ -154,39 +170,122 @@ dcon::text_sequence_id create_text_entry(sys::state& state, std::string_view key
 	}
 }
 
-void consume_csv_file(sys::state& state, uint32_t language, char const* file_content, uint32_t file_size) {
+// The rows of one csv file, read into storage of its own so that the files can be read in parallel. The component text
+// is laid out as in the state's text pool, with keys relative to the start of this batch.
+struct csv_text_batch {
+	struct entry {
+		uint32_t key_start = 0;
+		uint32_t key_length = 0;
+		text_sequence sequence;
+	};
+
+	std::vector<char> text_data;
+	std::vector<text_component> text_components;
+	std::vector<char> keys; // lowercase, without terminators
+	std::vector<entry> entries;
+};
+
+void read_csv_file(csv_text_batch& batch, uint32_t language, char const* file_content, uint32_t file_size) {
 	auto start = (file_size != 0 && file_content[0] == '#')
 									 ? parsers::csv_advance_to_next_line(file_content, file_content + file_size)
 									 : file_content;
 	while(start < file_content + file_size) {
 		start = parsers::parse_first_and_nth_csv_values(language, start, file_content + file_size, ';',
-				[&state](std::string_view key, std::string_view content) {
-					create_text_entry(state, key, content);
+				[&batch](std::string_view key, std::string_view content) {
+					auto key_start = uint32_t(batch.keys.size());
+					for(auto ch : key)
+						batch.keys.push_back(char(tolower(ch)));
+					batch.entries.push_back(csv_text_batch::entry{ key_start, uint32_t(key.length()),
+						create_text_sequence(batch.text_data, batch.text_components, content) });
 				});
 	}
 }
 
+// Adds a batch to the state; a key that is already defined is replaced, so that the batch that is merged last wins
+void merge_csv_batch(sys::state& state, csv_text_batch const& batch) {
+	auto const text_base = uint32_t(state.text_data.size());
+	auto const component_base = uint32_t(state.text_components.size());
+
+	state.text_data.insert(state.text_data.end(), batch.text_data.begin(), batch.text_data.end());
+	for(auto& c : batch.text_components) {
+		if(std::holds_alternative<dcon::text_key>(c)) {
+			auto k = std::get<dcon::text_key>(c);
+			state.text_components.emplace_back(dcon::text_key(uint32_t(k.index() + text_base)));
+		} else {
+			state.text_components.push_back(c);
+		}
+	}
+	assert(state.text_components.size() < std::numeric_limits<uint32_t>::max());
+
+	bool replaced_any = false;
+	for(auto& e : batch.entries) {
+		auto key = std::string_view(batch.keys.data() + e.key_start, e.key_length);
+		auto sequence_record = text_sequence{ e.sequence.starting_component + component_base, e.sequence.component_count };
+
+		if(auto it = state.key_to_text_sequence.find(key); it != state.key_to_text_sequence.end()) {
+			// maybe report an error here -- repeated definition
+			state.text_sequences[it->second] = sequence_record;
+			replaced_any = true;
+		} else {
+			const auto nh = state.text_sequences.size();
+			state.text_sequences.push_back(sequence_record);
+
+			auto main_key = state.add_to_pool(key);
+			dcon::text_sequence_id new_k{ dcon::text_sequence_id::value_base_t(nh) };
+			state.key_to_text_sequence.insert_or_assign(main_key, new_k);
+		}
+	}
+	if(replaced_any)
+		state.layout_cache.clear();
+}
+
+void consume_csv_file(sys::state& state, uint32_t language, char const* file_content, uint32_t file_size) {
+	csv_text_batch batch;
+	read_csv_file(batch, language, file_content, file_size);
+	merge_csv_batch(state, batch);
+}
+
 void load_text_data(sys::state& state, uint32_t language) {
 	auto rt = get_root(state.common_fs);
 
+	std::vector<simple_fs::file> files;
+
 	// first, load in special mod gui
 	// TODO put this in a better location
 	auto alice_csv = open_file(rt, NATIVE("assets/alice.csv"));
-	if(alice_csv) {
-		auto content = view_contents(*alice_csv);
-		consume_csv_file(state, language, content.data, content.file_size);
-	}
+	if(alice_csv)
+		files.push_back(std::move(*alice_csv));
 
 	auto text_dir = open_directory(rt, NATIVE("localisation"));
 	auto all_files = list_files(text_dir, NATIVE(".csv"));
 
 	for(auto& file : all_files) {
 		auto ofile = open_file(file);
-		if(ofile) {
-			auto content = view_contents(*ofile);
-			consume_csv_file(state, language, content.data, content.file_size);
-		}
+		if(ofile)
+			files.push_back(std::move(*ofile));
 	}
+
+	// the files are read in parallel and then added in order, so a later file still overrides the keys of an earlier one
+	std::vector<csv_text_batch> batches(files.size());
+	concurrency::parallel_for(size_t(0), files.size(), [&](size_t i) {
+		auto content = view_contents(files[i]);
+		read_csv_file(batches[i], language, content.data, content.file_size);
+	});
+
+	size_t text_size = 0;
+	size_t component_count = 0;
+	size_t entry_count = 0;
+	for(auto& b : batches) {
+		text_size += b.text_data.size() + b.keys.size() + b.entries.size();
+		component_count += b.text_components.size();
+		entry_count += b.entries.size();
+	}
+	state.text_data.reserve(state.text_data.size() + text_size);
+	state.text_components.reserve(state.text_components.size() + component_count);
+	state.key_to_text_sequence.reserve(state.key_to_text_sequence.size() + entry_count);
+
+	for(auto& b : batches)
+		merge_csv_batch(state, b);
 }
 
 template<size_t N>
@@ -672,19 +771,43 @@ std::string produce_simple_string(sys::state const& state, dcon::text_sequence_i
 	return result;
 }
 
+dcon::text_sequence_id find_key(sys::state const& state, std::string_view txt) {
+	// keys are stored lowercase; keys that are already lowercase are looked up as-is and the rest are
+	// lowered into a stack buffer, so that the common case never touches the heap
+	auto lookup = [&](std::string_view k) {
+		auto it = state.key_to_text_sequence.find(k);
+		return it != state.key_to_text_sequence.end() ? it->second : dcon::text_sequence_id{};
+	};
+
+	bool has_upper = false;
+	for(auto ch : txt) {
+		if(ch >= 'A' && ch <= 'Z') {
+			has_upper = true;
+			break;
+		}
+	}
+	if(!has_upper)
+		return lookup(txt);
+
+	char buffer[256];
+	if(txt.size() > sizeof(buffer))
+		return lookup(lowercase_str(txt));
+	for(size_t i = 0; i < txt.size(); ++i)
+		buffer[i] = char(tolower(txt[i]));
+	return lookup(std::string_view(buffer, txt.size()));
+}
+
 std::string produce_simple_string(sys::state const& state, std::string_view txt) {
-	auto it = state.key_to_text_sequence.find(lowercase_str(txt));
-	if(it != state.key_to_text_sequence.end()) {
-		return produce_simple_string(state, it->second);
+	if(auto k = find_key(state, txt); k) {
+		return produce_simple_string(state, k);
 	} else {
 		return std::string(txt);
 	}
 }
 
 dcon::text_sequence_id find_or_add_key(sys::state& state, std::string_view txt) {
-	auto it = state.key_to_text_sequence.find(lowercase_str(txt));
-	if(it != state.key_to_text_sequence.end()) {
-		return it->second;
+	if(auto k = find_key(state, txt); k) {
+		return k;
 	} else {
 		auto new_key = state.add_to_pool_lowercase(txt);
 		std::string local_key_copy{ state.to_string_view(new_key) };
@@ -1207,19 +1330,101 @@ std::string lb_resolve_substitution(sys::state& state, substitution sub, substit
 
 } // namespace impl
 
+namespace impl {
+
+template<typename T>
+void append_key_bytes(std::string& key, T const& v) {
+	key.append(reinterpret_cast<char const*>(&v), sizeof(T));
+}
+
+size_t layout_cache_entry_memory(layout_cache_entry const& e) {
+	size_t total = sizeof(layout_cache_entry) + 2 * e.key.capacity() + 4 * sizeof(void*) + e.chunks.capacity() * sizeof(cached_layout_chunk);
+	for(auto& c : e.chunks)
+		total += c.chunk.win1250chars.capacity();
+	return total;
+}
+
+} // namespace impl
+
 void add_to_layout_box(sys::state& state, layout_base& dest, layout_box& box, dcon::text_sequence_id source_text, substitution_map const& mp) {
 	if(!source_text)
 		return;
 
 	auto current_color = dest.fixed_parameters.color;
-	auto font_index = text::font_index_from_font_id(dest.fixed_parameters.font_id);
-	auto font_size = text::size_from_font_id(dest.fixed_parameters.font_id);
-	auto& font = state.font_collection.fonts[font_index - 1];
-	auto text_height = int32_t(std::ceil(font.line_height(font_size)));
-	auto line_height = text_height + dest.fixed_parameters.leading;
-
 	auto seq = state.text_sequences[source_text];
+
+	// resolve substitutions first: their text is part of the cache key
+	std::vector<std::string> resolved;
+	auto& key = state.layout_cache.scratch_key;
+	key.clear();
+	impl::append_key_bytes(key, source_text);
+	impl::append_key_bytes(key, dest.fixed_parameters.left);
+	impl::append_key_bytes(key, dest.fixed_parameters.right);
+	impl::append_key_bytes(key, dest.fixed_parameters.font_id);
+	impl::append_key_bytes(key, dest.fixed_parameters.leading);
+	impl::append_key_bytes(key, dest.fixed_parameters.align);
+	impl::append_key_bytes(key, dest.fixed_parameters.color);
+	impl::append_key_bytes(key, dest.fixed_parameters.suppress_hyperlinks);
+	impl::append_key_bytes(key, box.x_offset);
+	impl::append_key_bytes(key, state.user_settings.use_classic_fonts);
+	for(size_t i = seq.starting_component; i < size_t(seq.starting_component + seq.component_count); ++i) {
+		if(std::holds_alternative<text::variable_type>(state.text_components[i])) {
+			auto var_type = std::get<text::variable_type>(state.text_components[i]);
+			if(auto it = mp.find(uint32_t(var_type)); it != mp.end()) {
+				resolved.push_back(impl::lb_resolve_substitution(state, it->second, mp));
+				impl::append_key_bytes(key, uint8_t(it->second.index()));
+			} else {
+				resolved.push_back(std::string("???"));
+				impl::append_key_bytes(key, uint8_t(0xFF));
+			}
+			key.append(resolved.back());
+			key.push_back(0);
+		}
+	}
+
+	// only text that starts on a fresh line lays out independently of what came before it in the box
+	bool cacheable = box.line_start == dest.base_layout.contents.size() && box.x_position == float(box.x_offset + dest.fixed_parameters.left);
+	auto& cache = state.layout_cache;
+
+	if(cacheable) {
+		if(auto it = cache.index.find(std::string_view(key)); it != cache.index.end()) {
+			auto entry = it->second;
+			cache.entries.splice(cache.entries.begin(), cache.entries, entry);
+
+			for(auto& c : entry->chunks) {
+				auto& added = dest.base_layout.contents.emplace_back(c.chunk);
+				added.y = int16_t(added.y + box.y_position);
+				if(c.source_variable != 0 && !dest.fixed_parameters.suppress_hyperlinks) {
+					if(auto sit = mp.find(c.source_variable - 1); sit != mp.end())
+						added.source = sit->second;
+				}
+			}
+			if(entry->y_size != std::numeric_limits<int32_t>::min())
+				box.y_size = std::max(box.y_size, box.y_position + entry->y_size);
+			box.x_size = std::max(box.x_size, entry->x_size);
+			box.x_position = entry->x_position;
+			box.y_position += entry->y_advance;
+			box.line_start = dest.base_layout.contents.size() - entry->chunks_on_last_line;
+			dest.base_layout.number_of_lines += entry->lines;
+			return;
+		}
+	}
+
+	auto first_chunk = dest.base_layout.contents.size();
+	auto start_y = box.y_position;
+	auto start_lines = dest.base_layout.number_of_lines;
+	auto old_x_size = box.x_size;
+	auto old_y_size = box.y_size;
+	if(cacheable) {
+		box.x_size = 0;
+		box.y_size = std::numeric_limits<int32_t>::min();
+	}
+	std::vector<uint32_t> chunk_sources;
+
+	uint32_t next_resolved = 0;
 	for(size_t i = seq.starting_component; i < size_t(seq.starting_component + seq.component_count); ++i) {
+		auto before = dest.base_layout.contents.size();
+		uint32_t source_variable = 0;
 		if(std::holds_alternative<dcon::text_key>(state.text_components[i])) {
 			auto tkey = std::get<dcon::text_key>(state.text_components[i]);
 			std::string_view text = state.to_string_view(tkey);
@@ -1233,13 +1438,52 @@ void add_to_layout_box(sys::state& state, layout_base& dest, layout_box& box, dc
 				current_color = std::get<text::text_color>(state.text_components[i]);
 		} else if(std::holds_alternative<text::variable_type>(state.text_components[i])) {
 			auto var_type = std::get<text::variable_type>(state.text_components[i]);
+			auto& txt = resolved[next_resolved++];
 			if(auto it = mp.find(uint32_t(var_type)); it != mp.end()) {
-				auto txt = impl::lb_resolve_substitution(state, it->second, mp);
 				add_to_layout_box(state, dest, box, std::string_view(txt), current_color, it->second);
+				source_variable = uint32_t(var_type) + 1;
 			} else {
-				add_to_layout_box(state, dest, box, std::string_view("???"), current_color, std::monostate{});
+				add_to_layout_box(state, dest, box, std::string_view(txt), current_color, std::monostate{});
 			}
 		}
+		if(cacheable)
+			chunk_sources.resize(dest.base_layout.contents.size() - first_chunk, 0);
+		if(cacheable && source_variable != 0) {
+			for(auto j = before; j < dest.base_layout.contents.size(); ++j)
+				chunk_sources[j - first_chunk] = source_variable;
+		}
+	}
+
+	if(!cacheable)
+		return;
+
+	layout_cache_entry entry;
+	entry.key = key;
+	entry.x_position = box.x_position;
+	entry.y_advance = box.y_position - start_y;
+	entry.x_size = box.x_size;
+	entry.y_size = box.y_size == std::numeric_limits<int32_t>::min() ? box.y_size : box.y_size - start_y;
+	entry.lines = dest.base_layout.number_of_lines - start_lines;
+	entry.chunks_on_last_line = uint32_t(dest.base_layout.contents.size() - box.line_start);
+	entry.chunks.reserve(dest.base_layout.contents.size() - first_chunk);
+	for(auto j = first_chunk; j < dest.base_layout.contents.size(); ++j) {
+		auto& c = entry.chunks.emplace_back(cached_layout_chunk{dest.base_layout.contents[j], chunk_sources[j - first_chunk]});
+		c.chunk.y = int16_t(c.chunk.y - start_y);
+		c.chunk.source = std::monostate{};
+	}
+	entry.memory = impl::layout_cache_entry_memory(entry);
+
+	box.x_size = std::max(old_x_size, box.x_size);
+	box.y_size = std::max(old_y_size, box.y_size);
+
+	cache.memory_used += entry.memory;
+	cache.entries.push_front(std::move(entry));
+	cache.index.insert_or_assign(std::string_view(cache.entries.front().key), cache.entries.begin());
+	while(cache.memory_used > cache.memory_budget && cache.entries.size() > 1) {
+		auto& oldest = cache.entries.back();
+		cache.index.erase(std::string_view(oldest.key));
+		cache.memory_used -= oldest.memory;
+		cache.entries.pop_back();
 	}
 }
 
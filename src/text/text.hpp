@@ -1,6 +1,8 @@
 #pragma once
 
 #include <stdint.h>
+#include <limits>
+#include <list>
 #include <variant>
 #include <vector>
 #include <string>
@@ -635,6 +637,38 @@ struct endless_layout : public layout_base {
 	void internal_close_box(layout_box& box) final;
 };
 
+// Result of laying out one text sequence from the start of an empty line, with positions relative to that start.
+// The key is built from the sequence, the layout parameters and the resolved substitution text, so an entry is
+// only reused when the output would be identical.
+struct cached_layout_chunk {
+	text_chunk chunk;
+	uint32_t source_variable = 0; // variable_type + 1 of the substitution the chunk came from, or 0
+};
+struct layout_cache_entry {
+	std::string key;
+	std::vector<cached_layout_chunk> chunks;
+	float x_position = 0.0f;
+	int32_t y_advance = 0;
+	int32_t x_size = 0;
+	int32_t y_size = std::numeric_limits<int32_t>::min();
+	int32_t lines = 0;
+	uint32_t chunks_on_last_line = 0;
+	size_t memory = 0;
+};
+struct layout_cache {
+	std::list<layout_cache_entry> entries; // most recently used first
+	ankerl::unordered_dense::map<std::string_view, std::list<layout_cache_entry>::iterator> index;
+	size_t memory_used = 0;
+	size_t memory_budget = size_t(4) << 20;
+	std::string scratch_key;
+
+	void clear() {
+		index.clear();
+		entries.clear();
+		memory_used = 0;
+	}
+};
+
 text_color char_to_color(char in);
 
 endless_layout create_endless_layout(layout& dest, layout_parameters const& params);
@@ -663,12 +697,16 @@ void close_layout_box(layout_base& dest, layout_box& box);
 void add_to_substitution_map(substitution_map& mp, variable_type key, substitution value);
 void add_to_substitution_map(substitution_map& mp, variable_type key, std::string const&); // DO NOT USE THIS FUNCTION
 
+// appends the text and a terminator to a text pool and returns its key; empty text gets the invalid key
+dcon::text_key add_to_pool(std::vector<char>& text_data, std::string_view new_text);
 void consume_csv_file(sys::state& state, uint32_t language, char const* file_content, uint32_t file_size);
 variable_type variable_type_from_name(std::string_view);
 void load_text_data(sys::state& state, uint32_t language);
 char16_t win1250toUTF16(char in);
 std::string produce_simple_string(sys::state const& state, dcon::text_sequence_id id);
 std::string produce_simple_string(sys::state const& state, std::string_view key);
+// case-insensitive lookup that does not allocate for keys up to 256 characters; returns an invalid id when missing
+dcon::text_sequence_id find_key(sys::state const& state, std::string_view key);
 dcon::text_sequence_id find_or_add_key(sys::state& state, std::string_view key);
 std::string date_to_string(sys::state const& state, sys::date date);
 
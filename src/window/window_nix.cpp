@@ -282,6 +282,7 @@ void create_window(sys::state& game_state, creation_parameters const& params) {
 		// Run game code
 
 		game_state.render();
+		ogl::flush_sprite_batch(game_state);
 		glfwSwapBuffers(window);
 
 		sound::update_music_track(game_state);
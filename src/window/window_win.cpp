@@ -392,6 +392,7 @@ void create_window(sys::state& game_state, creation_parameters const& params) {
 			// Run game code
 
 			game_state.render();
+			ogl::flush_sprite_batch(game_state);
 			SwapBuffers(game_state.win_ptr->opengl_window_dc);
 		}
 	}
@@ -2,6 +2,7 @@
 #include "system_state.hpp"
 #include "date_interface.hpp"
 #include "cyto_any.hpp"
+#include "text_batch.hpp"
 
 TEST_CASE("string pool tests", "[misc_tests]") {
 	std::unique_ptr<sys::state> state = std::make_unique<sys::state>();
@@ -225,3 +226,150 @@ TEST_CASE("cyto payload tests", "[misc_tests]") {
 		REQUIRE(any_cast<void *>(vp_payload) == (void *)nullptr);
 	}
 }
+
+TEST_CASE("text batch tests", "[misc_tests]") {
+	ogl::text_batch batch;
+	REQUIRE(batch.empty());
+
+	batch.add_glyph(uint8_t('A'), 10.0f, 20.0f, 16.0f); // 0x41: page 1, cell 1
+	batch.add_glyph(uint8_t(0xE9), 26.0f, 20.0f, 16.0f); // page 3, cell 41
+	batch.add_glyph(uint8_t('B'), 42.0f, 20.0f, 16.0f);
+
+	REQUIRE(!batch.empty());
+	REQUIRE(batch.pages[0].empty());
+	REQUIRE(batch.pages[1].size() == size_t(12));
+	REQUIRE(batch.pages[2].empty());
+	REQUIRE(batch.pages[3].size() == size_t(6));
+
+	auto const& a = batch.pages[1];
+	REQUIRE(a[0].x == 10.0f);
+	REQUIRE(a[0].y == 20.0f);
+	REQUIRE(a[0].u == 1.0f / 8.0f);
+	REQUIRE(a[0].v == 0.0f);
+	REQUIRE(a[2].x == 26.0f);
+	REQUIRE(a[2].y == 36.0f);
+	REQUIRE(a[2].u == 2.0f / 8.0f);
+	REQUIRE(a[2].v == 1.0f / 8.0f);
+	REQUIRE(a[6].x == 42.0f);
+	REQUIRE(a[6].u == 2.0f / 8.0f);
+
+	auto const& e = batch.pages[3];
+	REQUIRE(e[0].u == 1.0f / 8.0f);
+	REQUIRE(e[0].v == 5.0f / 8.0f);
+
+	batch.clear();
+	REQUIRE(batch.empty());
+}
+
+TEST_CASE("sprite batch tests", "[misc_tests]") {
+	float const square[] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f};
+
+	ogl::sprite_batch batch;
+	REQUIRE(batch.accepts(7, 4));
+	batch.texture = 7;
+	batch.color_subroutine = 4;
+	batch.add_quad(100.0f, 50.0f, 20.0f, 10.0f, square);
+	REQUIRE(batch.vertices.size() == size_t(6));
+	REQUIRE(batch.accepts(7, 4));
+	REQUIRE(!batch.accepts(8, 4));
+	REQUIRE(!batch.accepts(7, 3));
+
+	// third frame of a four frame strip
+	batch.add_quad(0.0f, 0.0f, 20.0f, 10.0f, square, 0.25f, 0.5f);
+	REQUIRE(batch.vertices.size() == size_t(12));
+	auto const& v = batch.vertices;
+	REQUIRE(v[0].x == 100.0f);
+	REQUIRE(v[0].y == 50.0f);
+	REQUIRE(v[2].x == 120.0f);
+	REQUIRE(v[2].y == 60.0f);
+	REQUIRE(v[2].u == 1.0f);
+	REQUIRE(v[6].u == 0.5f);
+	REQUIRE(v[8].u == 0.75f);
+	REQUIRE(v[8].v == 1.0f);
+
+	batch.clear();
+	REQUIRE(batch.accepts(8, 3));
+}
+
+class update_counting_element : public ui::element_base {
+public:
+	uint32_t domains = ui::update_domain::all;
+	int32_t update_count = 0;
+
+	uint32_t update_domains(sys::state& state) noexcept override {
+		return domains;
+	}
+	void on_update(sys::state& state) noexcept override {
+		++update_count;
+	}
+};
+
+TEST_CASE("partial ui update tests", "[misc_tests]") {
+	std::unique_ptr<sys::state> state = std::make_unique<sys::state>();
+	ui::container_base root;
+
+	auto a = std::make_unique<update_counting_element>();
+	a->domains = ui::update_domain::simulation;
+	auto b = std::make_unique<update_counting_element>();
+	b->domains = ui::update_domain::military | ui::update_domain::selection;
+	auto c = std::make_unique<update_counting_element>();
+	auto* pa = a.get();
+	auto* pb = b.get();
+	auto* pc = c.get();
+	root.add_child_to_back(std::move(a));
+	root.add_child_to_back(std::move(b));
+	root.add_child_to_back(std::move(c));
+
+	root.impl_on_update(*state, ui::update_domain::selection);
+	REQUIRE(pa->update_count == 0);
+	REQUIRE(pb->update_count == 1);
+	REQUIRE(pc->update_count == 1);
+
+	root.impl_on_update(*state, ui::update_domain::economy);
+	REQUIRE(pa->update_count == 1);
+	REQUIRE(pb->update_count == 1);
+	REQUIRE(pc->update_count == 2);
+
+	root.impl_on_update(*state);
+	REQUIRE(pa->update_count == 2);
+	REQUIRE(pb->update_count == 2);
+	REQUIRE(pc->update_count == 3);
+}
+
+TEST_CASE("sorted row model tests", "[misc_tests]") {
+	ui::sorted_row_model<dcon::pop_id> model;
+	std::vector<float> keys = { 5.0f, 1.0f, 4.0f, 2.0f, 3.0f };
+	auto key_of = [&](dcon::pop_id p) { return keys[p.index()]; };
+
+	std::vector<dcon::pop_id> rows;
+	for(uint16_t i = 0; i < 5; ++i)
+		rows.push_back(dcon::pop_id{ dcon::pop_id::value_base_t(i) });
+	model.sort(rows, key_of);
+	REQUIRE(rows[0] == dcon::pop_id{ 1 });
+	REQUIRE(rows[1] == dcon::pop_id{ 3 });
+	REQUIRE(rows[2] == dcon::pop_id{ 4 });
+	REQUIRE(rows[3] == dcon::pop_id{ 2 });
+	REQUIRE(rows[4] == dcon::pop_id{ 0 });
+
+	// rebuilt in source order, with one key changed and one row removed
+	keys[0] = 1.5f;
+	rows.clear();
+	for(uint16_t i = 0; i < 4; ++i)
+		rows.push_back(dcon::pop_id{ dcon::pop_id::value_base_t(i) });
+	model.sort(rows, key_of);
+	REQUIRE(rows.size() == 4);
+	REQUIRE(rows[0] == dcon::pop_id{ 1 });
+	REQUIRE(rows[1] == dcon::pop_id{ 0 });
+	REQUIRE(rows[2] == dcon::pop_id{ 3 });
+	REQUIRE(rows[3] == dcon::pop_id{ 2 });
+
+	// equal keys keep the order of the previous update
+	keys = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+	rows = { dcon::pop_id{ 3 }, dcon::pop_id{ 2 }, dcon::pop_id{ 4 }, dcon::pop_id{ 1 }, dcon::pop_id{ 0 } };
+	model.sort(rows, key_of);
+	REQUIRE(rows[0] == dcon::pop_id{ 1 });
+	REQUIRE(rows[1] == dcon::pop_id{ 0 });
+	REQUIRE(rows[2] == dcon::pop_id{ 3 });
+	REQUIRE(rows[3] == dcon::pop_id{ 2 });
+	REQUIRE(rows[4] == dcon::pop_id{ 4 });
+}
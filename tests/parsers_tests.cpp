@@ -175,7 +175,47 @@ void free_group(free_group_e_fn &o, exercising_combinations value, parsers::erro
 
 struct basic_copy : public basic_object_a {};
 
+// enough keys for the generated parser to dispatch through a perfect hash instead of the match tree
+struct many_keys {
+	int32_t k0 = 0;
+	int32_t k1 = 0;
+	int32_t k2 = 0;
+	int32_t k3 = 0;
+	int32_t k4 = 0;
+	int32_t k5 = 0;
+	int32_t k6 = 0;
+	int32_t k7 = 0;
+	int32_t k8 = 0;
+	int32_t k9 = 0;
+	int32_t key_number_10 = 0;
+	int32_t key_number_11 = 0;
+	int32_t key_number_12 = 0;
+	int32_t key_number_13 = 0;
+	int32_t key_number_14 = 0;
+	int32_t key_number_15 = 0;
+	int32_t key_number_16 = 0;
+	int32_t key_number_17 = 0;
+	int32_t key_number_18 = 0;
+	int32_t key_number_19 = 0;
+	int32_t key_number_20 = 0;
+	int32_t key_number_21 = 0;
+	int32_t key_number_22 = 0;
+	int32_t key_number_23 = 0;
+	int32_t key_number_24 = 0;
+	int32_t key_number_25 = 0;
+	int32_t key_number_26 = 0;
+	int32_t key_number_27 = 0;
+	int32_t key_number_28 = 0;
+	int32_t key_number_29 = 0;
+	int32_t key_number_30 = 0;
+	int32_t key_number_31 = 0;
+
+	void finish(int32_t) {
+	}
+};
+
 #include "test_parsers_generated.hpp"
+#include "test_parsers_match_tree_generated.hpp"
 
 inline exercising_combinations ec_stub(parsers::token_generator &gen, parsers::error_handler &err, int32_t context) {
 	auto tmp = parsers::parse_exercising_combinations(gen, err, context);
@@ -386,6 +426,53 @@ TEST_CASE("Generated parsers tests", "[parsers]") {
 		REQUIRE(created_object.lg0bb2 == 7);
 		REQUIRE(err.accumulated_errors.length() == size_t(0));
 	}
+	SECTION("perfect hash dispatch") {
+		char file_data[] =
+		    "k0 = 1\n"
+		    "K9 = 2\n"
+		    "key_number_10 = 3\n"
+		    "KEY_NUMBER_31 = 4\n"
+		    "key_number_3 = 5\n";
+
+		parsers::error_handler err("no file");
+		parsers::token_generator gen(file_data, file_data + strlen(file_data));
+
+		auto created_object = parsers::parse_many_keys(gen, err, 0);
+
+		REQUIRE(created_object.k0 == 1);
+		REQUIRE(created_object.k9 == 2);
+		REQUIRE(created_object.key_number_10 == 3);
+		REQUIRE(created_object.key_number_31 == 4);
+		REQUIRE(created_object.k3 == 0);
+		REQUIRE(err.accumulated_errors.length() != size_t(0));
+	}
+}
+
+TEST_CASE("token generator tests", "[parsers]") {
+	SECTION("long runs") {
+		// comments, whitespace, identifiers and strings that span several scan blocks
+		std::string file_data = "# " + std::string(70, 'c') + "\r\n\n" + std::string(40, ' ') + std::string(50, 'a') + "\t=\n{ \"" +
+			std::string(45, 'q') + "\" } x" + std::string(33, ',') + "\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n<=y";
+		parsers::token_generator gen(file_data.data(), file_data.data() + file_data.length());
+
+		auto t = gen.get();
+		REQUIRE(t.type == parsers::token_type::identifier);
+		REQUIRE(t.content == std::string(50, 'a'));
+		REQUIRE(t.line == 3);
+		REQUIRE(gen.get().type == parsers::token_type::special_identifier);
+		REQUIRE(gen.get().type == parsers::token_type::open_brace);
+		t = gen.get();
+		REQUIRE(t.type == parsers::token_type::quoted_string);
+		REQUIRE(t.content == std::string(45, 'q'));
+		REQUIRE(t.line == 4);
+		REQUIRE(gen.get().type == parsers::token_type::close_brace);
+		REQUIRE(gen.get().content == "x");
+		t = gen.get();
+		REQUIRE(t.content == "<=");
+		REQUIRE(t.line == 37);
+		REQUIRE(gen.get().content == "y");
+		REQUIRE(gen.at_end());
+	}
 }
 
 TEST_CASE("csv parser tests", "[parsers]") {
@@ -504,3 +591,103 @@ TEST_CASE("Floating point parser tests", "[parsers]") {
 		REQUIRE(val == -1.5);
 	}
 }
+
+// the same parsers generated again with every group dispatched through the match tree, in parsers::match_tree
+#include "parser_defs_match_tree_generated.hpp"
+
+TEST_CASE("generated parser dispatch", "[benchmarks]") {
+	SECTION("test_parsers") {
+		// many_keys is large enough to get the perfect hash; the files write keys in either case
+		std::string file;
+		for(int32_t repeat = 0; repeat < 256; ++repeat) {
+			for(int32_t i = 0; i < 32; ++i) {
+				file += (i < 10 ? "k" + std::to_string(i) : (repeat % 2 == 0 ? "key_number_" : "KEY_NUMBER_") + std::to_string(i));
+				file += " = " + std::to_string(i) + "\n";
+			}
+		}
+
+		parsers::error_handler err("many_keys");
+		parsers::token_generator gen(file.data(), file.data() + file.length());
+		auto hashed = parsers::parse_many_keys(gen, err, 0);
+		parsers::token_generator tree_gen(file.data(), file.data() + file.length());
+		auto tree = parsers::match_tree::parse_many_keys(tree_gen, err, 0);
+		REQUIRE(err.accumulated_errors.length() == size_t(0));
+		REQUIRE(hashed.k9 == 9);
+		REQUIRE(hashed.key_number_31 == 31);
+		REQUIRE(tree.k9 == hashed.k9);
+		REQUIRE(tree.key_number_31 == hashed.key_number_31);
+
+		BENCHMARK_ADVANCED("many_keys, match tree")(Catch::Benchmark::Chronometer meter) {
+			meter.measure([&]() {
+				parsers::error_handler e("many_keys");
+				parsers::token_generator g(file.data(), file.data() + file.length());
+				return parsers::match_tree::parse_many_keys(g, e, 0).key_number_31;
+			});
+		};
+		BENCHMARK_ADVANCED("many_keys, perfect hash")(Catch::Benchmark::Chronometer meter) {
+			meter.measure([&]() {
+				parsers::error_handler e("many_keys");
+				parsers::token_generator g(file.data(), file.data() + file.length());
+				return parsers::parse_many_keys(g, e, 0).key_number_31;
+			});
+		};
+	}
+#ifndef IGNORE_REAL_FILES_TESTS
+	SECTION("unit files") {
+		std::unique_ptr<sys::state> state = std::make_unique<sys::state>();
+		REQUIRE(std::string("NONE") != GAME_DIR); // If this fails, then you have not created a local_user_settings.hpp (read the documentation for contributors)
+		add_root(state->common_fs, NATIVE_M(GAME_DIR));
+		auto root = get_root(state->common_fs);
+
+		parsers::scenario_building_context context(*state);
+		parsers::error_handler err("");
+		{
+			auto common = open_directory(root, NATIVE("common"));
+			auto goods = open_file(common, NATIVE("goods.txt"));
+			REQUIRE(bool(goods));
+			auto content = view_contents(*goods);
+			err.file_name = "goods.txt";
+			parsers::token_generator gen(content.data, content.data + content.file_size);
+			parsers::parse_goods_file(gen, err, context); // the build and supply costs name commodities
+		}
+
+		// unit_definition is large enough to get the perfect hash
+		std::vector<simple_fs::file> unit_files;
+		auto units = open_directory(root, NATIVE("units"));
+		for(auto unit_file : simple_fs::list_files(units, NATIVE(".txt"))) {
+			if(auto opened_file = open_file(unit_file); opened_file)
+				unit_files.emplace_back(std::move(*opened_file));
+		}
+		REQUIRE(unit_files.size() != size_t(0));
+
+		// each file holds name = { ... } entries, which parse_unit_file hands to make_unit
+		auto parse_all = [&](auto&& parse_unit_definition) {
+			float sum = 0.0f;
+			for(auto& f : unit_files) {
+				auto content = view_contents(f);
+				parsers::token_generator gen(content.data, content.data + content.file_size);
+				for(auto name = gen.get(); name.type != parsers::token_type::unknown; name = gen.get()) {
+					gen.get();
+					gen.get();
+					sum += parse_unit_definition(gen).maximum_speed;
+				}
+			}
+			return sum;
+		};
+		auto hashed = [&](parsers::token_generator& gen) { return parsers::parse_unit_definition(gen, err, context); };
+		auto tree = [&](parsers::token_generator& gen) { return parsers::match_tree::parse_unit_definition(gen, err, context); };
+
+		auto expected = parse_all(hashed);
+		REQUIRE(expected > 0.0f);
+		REQUIRE(parse_all(tree) == expected);
+		REQUIRE(err.accumulated_errors == "");
+
+		BENCHMARK_ADVANCED("unit files, match tree")(Catch::Benchmark::Chronometer meter) {
+			meter.measure([&]() { return parse_all(tree); });
+		};
+		BENCHMARK_ADVANCED("unit files, perfect hash")(Catch::Benchmark::Chronometer meter) {
+			meter.measure([&]() { return parse_all(hashed); });
+		};
+	}
+#endif
+}
@@ -2173,6 +2173,147 @@ TEST_CASE("event performance", "[benchmarks]") {
 		});
 	};
 }
+
+TEST_CASE("unit compaction", "[benchmarks]") {
+	auto ws = load_testing_scenario_file();
+	auto &state = *ws;
+
+	// simulate a long game: build a lot of extra regiments and then lose most of them, leaving holes below live ones
+	dcon::army_id a;
+	for(auto ar : state.world.in_army) {
+		a = ar;
+		break;
+	}
+	REQUIRE(bool(a));
+	auto t = state.military_definitions.infantry;
+	for(uint32_t i = 0; i < 8000; ++i) {
+		auto r = military::create_new_regiment(state, dcon::nation_id{}, t);
+		state.world.try_create_army_membership(r, a);
+	}
+	for(uint32_t i = state.world.regiment_size(); i-- > 0;) {
+		dcon::regiment_id r{dcon::regiment_id::value_base_t(i)};
+		if(state.world.regiment_is_valid(r) && (i % 5) != 0 && state.world.regiment_get_army_from_army_membership(r) == a)
+			state.world.delete_regiment(r);
+	}
+
+	auto total_strength = [&]() {
+		float total = 0.0f;
+		for(auto r : state.world.in_regiment)
+			total += r.get_strength() * float(r.get_army_from_army_membership().id.index() + 1);
+		return total;
+	};
+	auto count_in_army = [&]() {
+		auto rng = state.world.army_get_army_membership(a);
+		return int32_t(rng.end() - rng.begin());
+	};
+
+	auto sparse_size = state.world.regiment_size();
+	auto before_strength = total_strength();
+	auto before_count = count_in_army();
+
+	BENCHMARK_ADVANCED("sparse regiment loop")
+	(Catch::Benchmark::Chronometer meter) {
+		meter.measure([&]() { return total_strength(); });
+	};
+
+	state.defines.alice_unit_compaction_threshold = 1.0f;
+	REQUIRE(military::compact_units(state));
+	REQUIRE(state.world.regiment_size() < sparse_size);
+	for(uint32_t i = 0; i < state.world.regiment_size(); ++i) {
+		REQUIRE(state.world.regiment_is_valid(dcon::regiment_id{dcon::regiment_id::value_base_t(i)}));
+	}
+	REQUIRE(total_strength() == Approx(before_strength));
+	REQUIRE(count_in_army() == before_count);
+
+	BENCHMARK_ADVANCED("compacted regiment loop")
+	(Catch::Benchmark::Chronometer meter) {
+		meter.measure([&]() { return total_strength(); });
+	};
+}
+
+TEST_CASE("province spatial index", "[benchmarks]") {
+	auto ws = load_testing_scenario_file();
+	auto &state = *ws;
+
+	for(uint32_t i = 0; i < state.world.province_size(); i += 37) {
+		dcon::province_id from{dcon::province_id::value_base_t(i)};
+		int32_t in_radius = 0;
+		province::for_each_province_within(state, from, -0.99f, [&](dcon::province_id p) { ++in_radius; });
+		int32_t expected = 0;
+		for(auto p : state.world.in_province) {
+			if(province::sorting_distance(state, from, p) < -0.99f)
+				++expected;
+		}
+		REQUIRE(in_radius == expected);
+	}
+
+	BENCHMARK_ADVANCED("radius query")
+	(Catch::Benchmark::Chronometer meter) {
+		meter.measure([&]() {
+			int32_t total = 0;
+			for(uint32_t i = 0; i < state.world.province_size(); ++i)
+				province::for_each_province_within(state, dcon::province_id{dcon::province_id::value_base_t(i)}, -0.996f, [&](dcon::province_id p) { ++total; });
+			return total;
+		});
+	};
+	BENCHMARK_ADVANCED("brute force radius scan")
+	(Catch::Benchmark::Chronometer meter) {
+		meter.measure([&]() {
+			int32_t total = 0;
+			for(uint32_t i = 0; i < state.world.province_size(); ++i) {
+				for(auto p : state.world.in_province) {
+					if(province::sorting_distance(state, dcon::province_id{dcon::province_id::value_base_t(i)}, p) < -0.996f)
+						++total;
+				}
+			}
+			return total;
+		});
+	};
+}
+
+TEST_CASE("flag decoding", "[benchmarks]") {
+	auto ws = load_testing_scenario_file();
+	auto &state = *ws;
+
+	// the same set of files that preload_flag_textures decodes
+	std::vector<native_string> files;
+	for(auto n : state.world.in_nation) {
+		auto ident = n.get_identity_from_identity_holder().id;
+		if(ident && n.get_owned_province_count() != 0)
+			files.push_back(ogl::flag_file_name(state, ident, culture::get_current_flag_type(state, n.id)));
+	}
+	REQUIRE(files.size() > size_t(0));
+
+	auto decode_all = [&](auto&& for_each_index) {
+		std::vector<ogl::decoded_image> images(files.size());
+		for_each_index([&](size_t i) { images[i] = ogl::decode_image(files[i], state.common_fs); });
+		size_t found = 0;
+		for(auto& img : images) {
+			if(img.found)
+				++found;
+			if(img.data)
+				STBI_FREE(img.data);
+		}
+		return found;
+	};
+	auto serially = [&](auto&& f) {
+		for(size_t i = 0; i < files.size(); ++i)
+			f(i);
+	};
+	auto in_parallel = [&](auto&& f) {
+		concurrency::parallel_for(size_t(0), files.size(), f);
+	};
+	REQUIRE(decode_all(serially) == decode_all(in_parallel));
+
+	BENCHMARK_ADVANCED("decode flags serially")
+	(Catch::Benchmark::Chronometer meter) {
+		meter.measure([&]() { return decode_all(serially); });
+	};
+	BENCHMARK_ADVANCED("decode flags in parallel")
+	(Catch::Benchmark::Chronometer meter) {
+		meter.measure([&]() { return decode_all(in_parallel); });
+	};
+}
 //
 //TEST_CASE(".mod overrides", "[req-game-files]") {
 //	parsers::error_handler err("");
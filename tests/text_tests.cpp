@@ -39,6 +39,70 @@ TEST_CASE("text from csv", "[parsers]") {
 			REQUIRE(state->to_string_view(
 			            std::get<dcon::text_key>(state->text_components[state->text_sequences[key].starting_component])) == "last");
 		}
+		{
+			auto key = state->key_to_text_sequence.find(std::string_view("bbb"))->second;
+			REQUIRE(text::find_key(*state, "bbb") == key);
+			REQUIRE(text::find_key(*state, "BbB") == key);
+			REQUIRE(bool(text::find_key(*state, "ddd")) == false);
+		}
+	}
+	SECTION("repeated_keys") {
+		std::unique_ptr<sys::state> state = std::make_unique<sys::state>();
+
+		text::consume_csv_file(*state, 2, RANGE_SZ("LABEL;first\nOTHER;other\n"));
+		text::consume_csv_file(*state, 2, RANGE_SZ("label;second;\nLabel;third$d$\n"));
+
+		REQUIRE(state->text_sequences.size() == size_t(2));
+
+		auto key = state->key_to_text_sequence.find(std::string_view("label"))->second;
+		REQUIRE(state->text_sequences[key].component_count == 2);
+		REQUIRE(state->to_string_view(
+		            std::get<dcon::text_key>(state->text_components[state->text_sequences[key].starting_component])) == "third");
+		auto other = state->key_to_text_sequence.find(std::string_view("other"))->second;
+		REQUIRE(state->to_string_view(
+		            std::get<dcon::text_key>(state->text_components[state->text_sequences[other].starting_component])) == "other");
+	}
+	SECTION("parallel_batches") {
+		std::string_view files[] = {
+			"#header\nLABEL;first\nOTHER;other$d$\nCOLOR;\xA7Ygold\xA7!\n",
+			"label;second;\nNEW_KEY;new\n",
+			"",
+			"Label;third$d$\nnew_key;newer\nLAST;last\n",
+		};
+
+		// reference: every row added on its own through create_text_entry, as files were read before batching
+		std::unique_ptr<sys::state> serial = std::make_unique<sys::state>();
+		for(auto f : files) {
+			auto start = (!f.empty() && f[0] == '#') ? parsers::csv_advance_to_next_line(f.data(), f.data() + f.length()) : f.data();
+			while(start < f.data() + f.length()) {
+				start = parsers::parse_first_and_nth_csv_values(2, start, f.data() + f.length(), ';',
+						[&](std::string_view key, std::string_view content) { text::create_text_entry(*serial, key, content); });
+			}
+		}
+
+		std::unique_ptr<sys::state> parallel = std::make_unique<sys::state>();
+		std::vector<text::csv_text_batch> batches(std::size(files));
+		concurrency::parallel_for(size_t(0), batches.size(), [&](size_t i) {
+			text::read_csv_file(batches[i], 2, files[i].data(), uint32_t(files[i].length()));
+		});
+		for(auto& b : batches)
+			text::merge_csv_batch(*parallel, b);
+
+		REQUIRE(parallel->text_sequences.size() == serial->text_sequences.size());
+		REQUIRE(parallel->key_to_text_sequence.size() == serial->key_to_text_sequence.size());
+		for(auto& [key, seq] : serial->key_to_text_sequence) {
+			auto pk = text::find_key(*parallel, serial->to_string_view(key));
+			REQUIRE(bool(pk) == true);
+			REQUIRE(parallel->text_sequences[pk].component_count == serial->text_sequences[seq].component_count);
+			REQUIRE(text::produce_simple_string(*parallel, pk) == text::produce_simple_string(*serial, seq));
+		}
+
+		// the file merged last wins
+		auto label = text::find_key(*parallel, "label");
+		REQUIRE(parallel->text_sequences[label].component_count == 2);
+		REQUIRE(parallel->to_string_view(
+		            std::get<dcon::text_key>(parallel->text_components[parallel->text_sequences[label].starting_component])) == "third");
+		REQUIRE(text::produce_simple_string(*parallel, text::find_key(*parallel, "new_key")) == "newer");
 	}
 }
 
@@ -67,3 +131,112 @@ TEST_CASE("text game files parsing", "[parsers]") {
 	}
 }
 #endif
+
+namespace {
+
+void layout_text_for_cache_test(sys::state& state, text::layout& dest, std::string_view key, int64_t value, bool bypass_cache = false) {
+	text::layout_parameters params;
+	params.right = 200;
+	params.bottom = 1000;
+	params.font_id = uint16_t(18);
+	auto layout = text::create_endless_layout(dest, params);
+	text::substitution_map mp;
+	text::add_to_substitution_map(mp, text::variable_type::val, value);
+	auto box = text::open_layout_box(layout);
+	if(bypass_cache)
+		state.layout_cache.clear();
+	text::add_to_layout_box(state, layout, box, text::find_key(state, key), mp);
+	text::add_line_break_to_layout_box(state, layout, box);
+	if(bypass_cache)
+		state.layout_cache.clear();
+	text::add_to_layout_box(state, layout, box, text::find_key(state, key), mp);
+	text::close_layout_box(layout, box);
+}
+
+bool same_layout(text::layout const& a, text::layout const& b) {
+	if(a.number_of_lines != b.number_of_lines || a.contents.size() != b.contents.size())
+		return false;
+	for(size_t i = 0; i < a.contents.size(); ++i) {
+		auto& x = a.contents[i];
+		auto& y = b.contents[i];
+		if(x.win1250chars != y.win1250chars || x.x != y.x || x.y != y.y || x.width != y.width || x.height != y.height ||
+				x.color != y.color || x.source.index() != y.source.index())
+			return false;
+	}
+	return true;
+}
+
+} // namespace
+
+TEST_CASE("text layout cache", "[text]") {
+	std::unique_ptr<sys::state> state = std::make_unique<sys::state>();
+	add_root(state->common_fs, NATIVE_M(PROJECT_ROOT));
+	text::load_standard_fonts(*state);
+
+	text::consume_csv_file(*state, 2, RANGE_SZ("CACHE_TEST;The quick \xA7Ybrown\xA7! fox jumps over the $VAL$ lazy dogs, and then it jumps over them again\n"));
+
+	SECTION("cached_equals_uncached") {
+		text::layout uncached;
+		layout_text_for_cache_test(*state, uncached, "cache_test", 12345, true);
+		REQUIRE(uncached.number_of_lines > 2);
+		REQUIRE(state->layout_cache.entries.size() == size_t(1));
+
+		text::layout cached;
+		layout_text_for_cache_test(*state, cached, "cache_test", 12345);
+		REQUIRE(state->layout_cache.entries.size() == size_t(1));
+		REQUIRE(same_layout(uncached, cached));
+
+		// a different substitution is a different entry
+		text::layout other;
+		layout_text_for_cache_test(*state, other, "cache_test", 678);
+		REQUIRE(state->layout_cache.entries.size() == size_t(2));
+		REQUIRE(!same_layout(uncached, other));
+
+		text::layout fresh;
+		layout_text_for_cache_test(*state, fresh, "cache_test", 678, true);
+		REQUIRE(same_layout(other, fresh));
+	}
+	SECTION("eviction_over_budget") {
+		auto& cache = state->layout_cache;
+		REQUIRE(cache.memory_budget == size_t(4) << 20);
+
+		text::layout dest;
+		layout_text_for_cache_test(*state, dest, "cache_test", 0);
+		auto first_key = cache.entries.front().key;
+		auto entry_size = cache.entries.front().memory;
+		REQUIRE(entry_size > 0);
+
+		auto needed = int64_t(cache.memory_budget / entry_size) + 16;
+		for(int64_t i = 1; i < needed; ++i) {
+			layout_text_for_cache_test(*state, dest, "cache_test", i);
+			REQUIRE(cache.memory_used <= cache.memory_budget);
+		}
+		REQUIRE(cache.entries.size() < size_t(needed));
+		REQUIRE(cache.index.size() == cache.entries.size());
+		REQUIRE(cache.index.find(std::string_view(first_key)) == cache.index.end());
+
+		size_t total = 0;
+		for(auto& e : cache.entries)
+			total += e.memory;
+		REQUIRE(total == cache.memory_used);
+	}
+	SECTION("cleared_on_redefinition") {
+		text::layout dest;
+		layout_text_for_cache_test(*state, dest, "cache_test", 1);
+		REQUIRE(!state->layout_cache.entries.empty());
+
+		text::consume_csv_file(*state, 2, RANGE_SZ("OTHER_KEY;unrelated\n"));
+		REQUIRE(!state->layout_cache.entries.empty());
+
+		text::consume_csv_file(*state, 2, RANGE_SZ("CACHE_TEST;short\n"));
+		REQUIRE(state->layout_cache.entries.empty());
+		REQUIRE(state->layout_cache.memory_used == size_t(0));
+
+		layout_text_for_cache_test(*state, dest, "cache_test", 1);
+		REQUIRE(dest.contents.size() == size_t(2));
+		REQUIRE(dest.contents[0].win1250chars == "short");
+
+		create_text_entry(*state, "cache_test", "replaced again");
+		REQUIRE(state->layout_cache.entries.empty());
+	}
+}
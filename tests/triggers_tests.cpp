@@ -718,6 +718,31 @@ TEST_CASE("batch-individual comparision", "[trigger_tests]") {
 	}
 }
 
+TEST_CASE("tooltip condition cache", "[trigger_tests]") {
+	auto ws = load_testing_scenario_file();
+
+	ui::trigger_tooltip::condition_cache_scope conditions;
+	int32_t checked = 0;
+	for(auto n : ws->world.in_nation) {
+		if(n.get_owned_province_count() == 0)
+			continue;
+		if(++checked > 16)
+			break;
+		for(auto d : ws->world.in_decision) {
+			for(auto k : {d.get_potential(), d.get_allow()}) {
+				if(!k)
+					continue;
+				auto data = ws->trigger_data.data() + ws->trigger_data_indices[k.index() + 1];
+				auto expected = trigger::evaluate(*ws, k, trigger::to_generic(n.id), trigger::to_generic(n.id), 0);
+				// the first call fills the cache for the whole tree, the second is answered from it
+				REQUIRE(ui::trigger_tooltip::evaluate_condition(*ws, data, trigger::to_generic(n.id), trigger::to_generic(n.id), 0) == expected);
+				REQUIRE(ui::trigger_tooltip::evaluate_condition(*ws, data, trigger::to_generic(n.id), trigger::to_generic(n.id), 0) == expected);
+			}
+		}
+	}
+	REQUIRE(checked > 0);
+}
+
 TEST_CASE("trigger payload translation", "[trigger_tests]") {
 	{
 		auto old_d = trigger::to_generic(dcon::province_id{42});